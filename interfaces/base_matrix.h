@@ -150,6 +150,7 @@
 #ifndef BASE_MATRIX_H
 #define BASE_MATRIX_H
 
+#include <iomanip>
 #include <iostream>
 #include <memory>
 #include "../utilities/math_vector.h"
@@ -17,7 +17,7 @@ ostream& operator <<(ostream& out, const BaseMatrix<T>& rhs)
     {
       out << setw(12) << rhs(i, j);
     }
-    out << endl;
+    out << '\n';
   }
   return out;
 }
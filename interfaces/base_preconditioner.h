@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////
+/// @file base_preconditioner.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the BasePreconditioner class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class BasePreconditioner
+/// @brief Is a template class that is an abstract base class for an
+///        approximation M of a matrix A whose solves are cheap. Iterative
+///        solvers take one of these and call apply() once per iteration.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn virtual ~BasePreconditioner()
+/// @brief Virtual destructor
+/// @pre None.
+/// @post None.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn virtual void setup(const SparseMatrix<T>& A)
+/// @brief Builds M from A. Called once per matrix.
+/// @pre A is square. Derived classes list any further requirements.
+/// @post apply() solves with M until setup() is called again.
+/// @param1 Matrix being preconditioned.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn virtual void apply(const MathVector<T>& r, MathVector<T>& z) const
+/// @brief z = M^-1 r.
+/// @pre setup() has been called. r and z have the size of A and z is not r.
+/// @post z holds the result.
+/// @param1 Vector to precondition, usually a residual.
+/// @param2 Destination.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef BASE_PRECONDITIONER_H
+#define BASE_PRECONDITIONER_H
+
+#include "../matrices/sparse_matrix.h"
+
+template <typename T>
+class BasePreconditioner
+{
+public:
+  virtual ~BasePreconditioner() {}
+
+  virtual void setup(const SparseMatrix<T>& A) = 0;
+  virtual void apply(const MathVector<T>& r, MathVector<T>& z) const = 0;
+};
+
+#endif //BASE_PRECONDITIONER_H
@@ -10,6 +10,9 @@
 #include "solvers/gaussian_solver.h"
 #include "solvers/dirichlet_solver.h"
 #include "solvers/qr_solver.h"
+#include "solvers/refinement_solver.h"
+#include "utilities/trace.h"
+#include "utilities/solver_service.h"
 
 using namespace std;
 
@@ -19,9 +22,38 @@ void run_generic_test(MatrixType mt);
 string get_input_file(MatrixType mt);
 
 
-int main()
+int main(int argc, char* argv[])
 {
-  run_generic_test<DenseMatrix<long double>, long double>(DENSE);
+  string trace_file;
+  string serve_path;
+
+  // --trace <file> writes a Chrome trace of the run to file
+  // --serve <path> answers binary requests on a Unix socket, - for stdio
+  for(int i = 1; i < argc; i++)
+  {
+    if(string(argv[i]) == "--trace" && i + 1 < argc)
+      trace_file = argv[++i];
+    else if(string(argv[i]) == "--serve" && i + 1 < argc)
+      serve_path = argv[++i];
+  }
+  Tracer::enable(!trace_file.empty());
+
+  if(serve_path.empty())
+    run_generic_test<DenseMatrix<long double>, long double>(DENSE);
+  else
+  {
+    SolverService<> service;
+    if(serve_path == "-")
+      service.serve(0, 1);
+    else
+      service.listen(serve_path);
+  }
+
+  if(!trace_file.empty())
+  {
+    ofstream trace_out(trace_file);
+    Tracer::writeChromeTrace(trace_out);
+  }
 
   return 0;
 }
@@ -32,6 +64,7 @@ void run_generic_test(MatrixType mt)
   ifstream file_in;
   int matrix_size;
   T temp;
+  TraceSpan load_span("run_generic_test::load");
 
   file_in.open(get_input_file(mt));
   if(!file_in.is_open())
@@ -49,6 +82,7 @@ void run_generic_test(MatrixType mt)
       matrix_a(i, j, temp);
     }
   file_in.close();
+  load_span.stop();
 
   MT matrix_b(matrix_a.clone());
   MathVector<T> b;
@@ -73,6 +107,11 @@ void run_generic_test(MatrixType mt)
   DirichletSolver<T, GaussianSolver> gsds(4);
   gsds.template makeMatrix<constants::xLower, constants::xUpper, constants::yLower, constants::yUpper>(matrix_a, b);
   cout << gsds(matrix_a, b) << endl;
+
+  cout << "=== RefinementSolver ===";
+  DirichletSolver<T, RefinementSolver<double>> rfds(4);
+  rfds.template makeMatrix<constants::xLower, constants::xUpper, constants::yLower, constants::yUpper>(matrix_a, b);
+  cout << rfds(matrix_a, b) << endl;
   //QRSolver qrs;
   
   //cout << solution << endl;
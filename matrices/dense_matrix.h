@@ -34,6 +34,14 @@
 /// @post All m_vectors of the calling object are cleared.
 //////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////
+/// @fn DenseMatrix<T>& operator +=(const BaseMatrix<T>& rhs)
+/// @brief In place version of +. The -= and *= operators work the same way.
+/// @pre The sizes of the matrices (rows and columns) must be equal.
+/// @post The called object holds the sum. Nothing is allocated.
+/// @return Returns the called object.
+//////////////////////////////////////////////////////////////////////
+
 #include "../interfaces/base_matrix.h"
 
 #ifndef DENSE_MATRIX_H
@@ -49,6 +57,7 @@ public:
   DenseMatrix(uint32_t n);
   DenseMatrix(uint32_t m, uint32_t n);
   DenseMatrix(const MathVector<T>& other);
+  DenseMatrix(const DenseMatrix& other);
   DenseMatrix(DenseMatrix&& other);
   virtual ~DenseMatrix();
 
@@ -66,6 +75,9 @@ public:
 
   // Operators
   DenseMatrix<T>& operator =(DenseMatrix<T> other);
+  DenseMatrix<T>& operator +=(const BaseMatrix<T>& rhs);
+  DenseMatrix<T>& operator -=(const BaseMatrix<T>& rhs);
+  DenseMatrix<T>& operator *=(double c);
   DenseMatrix<T> operator *(double c) const;
   DenseMatrix<T> operator +(const BaseMatrix<T>& rhs) const;
   DenseMatrix<T> operator -(const BaseMatrix<T>& rhs) const;
@@ -78,5 +90,6 @@ public:
 };
 
 #include "dense_matrix.hpp"
+#include "../utilities/blas.h"
 
 #endif //DENSE_MATRIX_H
@@ -24,7 +24,8 @@ DenseMatrix<T>::DenseMatrix(const unique_ptr<BaseMatrix<T>> rhs)
 
   for(uint32_t i = 0; i < this->m_num_rows; i++)
   {
-    for(uint32_t j = 0; j < this->m_num_rows; j++)
+    this->m_vectors[i] = MathVector<T>(this->m_num_columns);
+    for(uint32_t j = 0; j < this->m_num_columns; j++)
     {
       this->m_vectors[i].push(0);
       (*this)(i, j, (*rhs)(i, j));
@@ -74,6 +75,16 @@ DenseMatrix<T>::DenseMatrix(const MathVector<T>& other)
   }
 }
 
+template <typename T>
+DenseMatrix<T>::DenseMatrix(const DenseMatrix<T>& other)
+{
+  this->m_num_rows = other.m_num_rows;
+  this->m_num_columns = other.m_num_columns;
+  this->m_vectors = new MathVector<T>[this->m_num_rows];
+  for(uint32_t i = 0; i < this->m_num_rows; i++)
+    this->m_vectors[i] = other.m_vectors[i];
+}
+
 template <typename T>
 DenseMatrix<T>::DenseMatrix(DenseMatrix<T>&& other)
 {
@@ -143,37 +154,64 @@ DenseMatrix<T>& DenseMatrix<T>::operator =(DenseMatrix<T> other)
 }
 
 template <typename T>
-DenseMatrix<T> DenseMatrix<T>::operator*(double c) const
+DenseMatrix<T>& DenseMatrix<T>::operator +=(const BaseMatrix<T>& rhs)
 {
-  DenseMatrix<T> ret(this->clone());
-  for(uint32_t i = 0; i < ret.getNumRows(); i++)
-    ret[i] = c * ret[i];
-  return ret;
+  if(this->m_num_columns != rhs.getNumColumns() || this->m_num_rows != rhs.getNumRows())
+    throw domain_error("Sizes not equal. + DenseMatrix");
+
+  if(rhs.type() == DENSE)
+    for(uint32_t i = 0; i < this->m_num_rows; i++)
+      this->m_vectors[i] += rhs[i];
+  else
+    for(uint32_t i = 0; i < this->m_num_rows; i++)
+      for(uint32_t j = 0; j < this->m_num_columns; j++)
+        this->m_vectors[i].data()[j] += rhs(i, j);
+  return *this;
 }
 
 template <typename T>
-DenseMatrix<T> DenseMatrix<T>::operator+(const BaseMatrix<T>& rhs) const
+DenseMatrix<T>& DenseMatrix<T>::operator -=(const BaseMatrix<T>& rhs)
 {
   if(this->m_num_columns != rhs.getNumColumns() || this->m_num_rows != rhs.getNumRows())
-    throw domain_error("Sizes not equal. + DenseMatrix");
+    throw domain_error("Sizes not equal. - DenseMatrix");
 
-  DenseMatrix<T> ret(this->clone());
-  for(uint32_t i = 0; i < ret.getNumRows(); i++)
-    ret[i] += rhs[i];
-  return ret;
+  if(rhs.type() == DENSE)
+    for(uint32_t i = 0; i < this->m_num_rows; i++)
+      this->m_vectors[i] -= rhs[i];
+  else
+    for(uint32_t i = 0; i < this->m_num_rows; i++)
+      for(uint32_t j = 0; j < this->m_num_columns; j++)
+        this->m_vectors[i].data()[j] -= rhs(i, j);
+  return *this;
+}
+
+template <typename T>
+DenseMatrix<T>& DenseMatrix<T>::operator *=(double c)
+{
+  for(uint32_t i = 0; i < this->m_num_rows; i++)
+    scal(static_cast<T>(c), this->m_vectors[i]);
+  return *this;
 }
 
+template <typename T>
+DenseMatrix<T> DenseMatrix<T>::operator*(double c) const
+{
+  DenseMatrix<T> ret(*this);
+  return ret *= c;
+}
 
 template <typename T>
-DenseMatrix<T> DenseMatrix<T>::operator-(const BaseMatrix<T>& rhs) const
+DenseMatrix<T> DenseMatrix<T>::operator+(const BaseMatrix<T>& rhs) const
 {
-  if(this->m_num_columns != rhs.getNumColumns() || this->m_num_rows != rhs.getNumRows())
-    throw domain_error("Sizes not equal. - DenseMatrix");
+  DenseMatrix<T> ret(*this);
+  return ret += rhs;
+}
 
-  DenseMatrix<T> ret(this->clone());
-  for(uint32_t i = 0; i < ret.getNumRows(); i++)
-    ret[i] -= rhs[i];
-  return ret;
+template <typename T>
+DenseMatrix<T> DenseMatrix<T>::operator-(const BaseMatrix<T>& rhs) const
+{
+  DenseMatrix<T> ret(*this);
+  return ret -= rhs;
 }
 
 template <typename T>
@@ -183,6 +221,12 @@ DenseMatrix<T> DenseMatrix<T>::operator*(const BaseMatrix<T>& rhs) const
     throw domain_error("Matrix sizes not compatible: * DenseMatrix.");
 
   DenseMatrix<T> ret(this->getNumRows(), rhs.getNumColumns());
+  if(rhs.type() == DENSE)
+  {
+    gemm(T(1), *this, static_cast<const DenseMatrix<T>&>(rhs), T(0), ret);
+    return ret;
+  }
+
   for(uint32_t i = 0; i < ret.getNumRows(); i++)
     for(uint32_t j = 0; j < ret.getNumColumns(); j++)
       for(uint32_t k = 0; k < this->getNumColumns(); k++)
@@ -196,28 +240,17 @@ MathVector<T> DenseMatrix<T>::operator *(const MathVector<T>& rhs) const
 {
   if(this->getNumColumns() != rhs.size())
     throw domain_error("Matrix sizes not compatible: * DenseMatrix.");
-  MathVector<T> temp = rhs;
-  MathVector<T> ret(temp.size());
-  T sum = 0;
+  MathVector<T> ret(this->getNumRows());
   for(uint32_t i = 0; i < this->getNumRows(); i++)
-  {
-    sum = 0;
-    for(uint32_t j = 0; j < temp.size(); j++)
-    {
-      sum += temp[j] * (*this)(i, j);
-    }
-    ret.push(sum);
-  }
+    ret.push(0);
+  gemv(T(1), *this, rhs, T(0), ret);
   return ret;
 }
 
 template <typename T>
 unique_ptr<BaseMatrix<T>> DenseMatrix<T>::clone() const
 {
-  unique_ptr<BaseMatrix<T>> ret = make_unique<DenseMatrix<T>>(this->m_num_rows, this->m_num_columns);
-  for (uint32_t i = 0; i < this->m_num_rows; i++)
-    (*ret)[i] = this->m_vectors[i];
-  return ret;
+  return make_unique<DenseMatrix<T>>(*this);
 }
 
 
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fixed_matrix.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the FixedMatrix class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class FixedMatrix
+/// @brief Is a template class for an M x N matrix whose size is known at
+///        compile time. It is not derived from BaseMatrix on purpose: the
+///        elements are a row major std::array inside the object, nothing
+///        is virtual, and every operation is unrolled for its size.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn constexpr FixedMatrix()
+/// @brief Explicit definition of the default constructor.
+/// @pre None.
+/// @post A FixedMatrix with every element set to 0.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn constexpr FixedMatrix(initializer_list<T> elements)
+/// @brief Overload of constructor which takes the elements row by row.
+/// @pre elements has at most M * N entries.
+/// @post Elements past the end of the list are 0.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn explicit FixedMatrix(const BaseMatrix<T>& other)
+/// @brief Overload of constructor which copies any BaseMatrix.
+/// @pre other is M x N.
+/// @post A FixedMatrix holding the elements of other.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn DenseMatrix<T> toDenseMatrix() const
+/// @brief Copies the called object into a DenseMatrix for the dynamic solvers.
+/// @pre None.
+/// @return Returns an M x N DenseMatrix.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn static constexpr FixedMatrix identity()
+/// @brief Returns the identity matrix.
+/// @pre M == N.
+/// @return Returns the M x M identity.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FIXED_MATRIX_H
+#define FIXED_MATRIX_H
+
+#include "dense_matrix.h"
+#include "../utilities/fixed_vector.h"
+
+template <typename T, uint32_t M, uint32_t N>
+class FixedMatrix
+{
+private:
+  array<T, M * N> m_elements;
+
+public:
+  // Constructors
+  constexpr FixedMatrix() : m_elements{} {}
+  constexpr FixedMatrix(initializer_list<T> elements);
+  explicit FixedMatrix(const BaseMatrix<T>& other);
+  static constexpr FixedMatrix identity();
+
+  // Getters
+  constexpr uint32_t getNumRows() const { return M; }
+  constexpr uint32_t getNumColumns() const { return N; }
+  T * data() { return m_elements.data(); }
+  const T * data() const { return m_elements.data(); }
+  DenseMatrix<T> toDenseMatrix() const;
+
+  // Index operators
+  constexpr T operator ()(uint32_t row_index, uint32_t column_index) const { return m_elements[row_index * N + column_index]; }
+  constexpr void operator ()(uint32_t row_index, uint32_t column_index, T element) { m_elements[row_index * N + column_index] = element; }
+  constexpr T& at(uint32_t row_index, uint32_t column_index) { return m_elements[row_index * N + column_index]; }
+
+  // Matrix operations
+  constexpr FixedMatrix<T, N, M> transpose() const;
+
+  // Operators
+  constexpr FixedMatrix& operator +=(const FixedMatrix& rhs);
+  constexpr FixedMatrix& operator -=(const FixedMatrix& rhs);
+  constexpr FixedMatrix& operator *=(T c);
+};
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator +(FixedMatrix<T, M, N> lhs, const FixedMatrix<T, M, N>& rhs);
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator -(FixedMatrix<T, M, N> lhs, const FixedMatrix<T, M, N>& rhs);
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator *(T c, FixedMatrix<T, M, N> rhs);
+
+template <typename T, uint32_t M, uint32_t K, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator *(const FixedMatrix<T, M, K>& lhs, const FixedMatrix<T, K, N>& rhs);
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedVector<T, M> operator *(const FixedMatrix<T, M, N>& lhs, const FixedVector<T, N>& rhs);
+
+template <typename T, uint32_t M, uint32_t N>
+ostream& operator <<(ostream& out, const FixedMatrix<T, M, N>& rhs);
+
+#include "fixed_matrix.hpp"
+
+#endif //FIXED_MATRIX_H
@@ -0,0 +1,142 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fixed_matrix.hpp
+/// @author Connor McBride
+/// @brief Contains the FixedMatrix class implementation information.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FIXED_MATRIX_HPP
+#define FIXED_MATRIX_HPP
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N>::FixedMatrix(initializer_list<T> elements) : m_elements{}
+{
+  uint32_t i = 0;
+  for(const T& element : elements)
+    m_elements[i++] = element;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+FixedMatrix<T, M, N>::FixedMatrix(const BaseMatrix<T>& other) : m_elements{}
+{
+  if(other.getNumRows() != M || other.getNumColumns() != N)
+    throw domain_error("Sizes not equal: FixedMatrix.");
+  for(uint32_t i = 0; i < M; i++)
+    for(uint32_t j = 0; j < N; j++)
+      m_elements[i * N + j] = other(i, j);
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> FixedMatrix<T, M, N>::identity()
+{
+  static_assert(M == N, "identity() needs a square FixedMatrix");
+  FixedMatrix<T, M, N> ret;
+  unroll<0, M>([&](auto i) { ret.at(i, i) = 1; });
+  return ret;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+DenseMatrix<T> FixedMatrix<T, M, N>::toDenseMatrix() const
+{
+  DenseMatrix<T> ret(M, N);
+  for(uint32_t i = 0; i < M; i++)
+  {
+    T * row = ret[i].data();
+    for(uint32_t j = 0; j < N; j++)
+      row[j] = m_elements[i * N + j];
+  }
+  return ret;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, N, M> FixedMatrix<T, M, N>::transpose() const
+{
+  FixedMatrix<T, N, M> ret;
+  unroll<0, M>([&](auto i)
+  {
+    unroll<0, N>([&](auto j) { ret.at(j, i) = (*this)(i, j); });
+  });
+  return ret;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N>& FixedMatrix<T, M, N>::operator +=(const FixedMatrix<T, M, N>& rhs)
+{
+  unroll<0, M * N>([&](auto i) { m_elements[i] += rhs.m_elements[i]; });
+  return *this;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N>& FixedMatrix<T, M, N>::operator -=(const FixedMatrix<T, M, N>& rhs)
+{
+  unroll<0, M * N>([&](auto i) { m_elements[i] -= rhs.m_elements[i]; });
+  return *this;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N>& FixedMatrix<T, M, N>::operator *=(T c)
+{
+  unroll<0, M * N>([&](auto i) { m_elements[i] *= c; });
+  return *this;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator +(FixedMatrix<T, M, N> lhs, const FixedMatrix<T, M, N>& rhs)
+{
+  return lhs += rhs;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator -(FixedMatrix<T, M, N> lhs, const FixedMatrix<T, M, N>& rhs)
+{
+  return lhs -= rhs;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator *(T c, FixedMatrix<T, M, N> rhs)
+{
+  return rhs *= c;
+}
+
+template <typename T, uint32_t M, uint32_t K, uint32_t N>
+constexpr FixedMatrix<T, M, N> operator *(const FixedMatrix<T, M, K>& lhs, const FixedMatrix<T, K, N>& rhs)
+{
+  FixedMatrix<T, M, N> ret;
+  // i-k-j order so the innermost statements walk rows of rhs and ret
+  unroll<0, M>([&](auto i)
+  {
+    unroll<0, K>([&](auto k)
+    {
+      T a = lhs(i, k);
+      unroll<0, N>([&](auto j) { ret.at(i, j) += a * rhs(k, j); });
+    });
+  });
+  return ret;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+constexpr FixedVector<T, M> operator *(const FixedMatrix<T, M, N>& lhs, const FixedVector<T, N>& rhs)
+{
+  FixedVector<T, M> ret;
+  unroll<0, M>([&](auto i)
+  {
+    T sum = 0;
+    unroll<0, N>([&](auto j) { sum += lhs(i, j) * rhs[j]; });
+    ret[i] = sum;
+  });
+  return ret;
+}
+
+template <typename T, uint32_t M, uint32_t N>
+ostream& operator <<(ostream& out, const FixedMatrix<T, M, N>& rhs)
+{
+  out << setprecision(5);
+  for(uint32_t i = 0; i < M; i++)
+  {
+    for(uint32_t j = 0; j < N; j++)
+      out << setw(12) << rhs(i, j);
+    out << endl;
+  }
+  return out;
+}
+
+#endif //FIXED_MATRIX_HPP
@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////
+/// @file skyline_matrix.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SkylineMatrix class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SkylineMatrix
+/// @brief Variable band (envelope) storage for matrices with a
+///        symmetric pattern. Row i keeps columns first(i) .. i - 1 of
+///        its lower triangle and column i keeps rows first(i) .. i - 1
+///        of its upper triangle, both contiguous, with the diagonal on
+///        its own. A fixed band of width b is the case first(i) = i - b.
+///        LU without pivoting and Cholesky create no entries outside the
+///        envelope, so a factor fits in the matrix it came from. With
+///        symmetric set only the lower triangle is kept. It is not a
+///        BaseMatrix since there are no rows to hand out as MathVectors.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SkylineMatrix(const SparseMatrix<T>& A, const vector<uint32_t>& order, bool symmetric)
+/// @brief Stores the envelope of P A P^T, where order[k] is the row of
+///        A that becomes row k.
+/// @pre A is square and order is a permutation of its rows. With
+///      symmetric A is symmetric and only its lower triangle is read.
+/// @post Every entry of P A P^T is stored, the envelope's other entries
+///       are 0.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SkylineMatrix(const SparseMatrix<T>& A, bool symmetric)
+/// @brief Same as above in the order A already has.
+/// @pre A is square.
+/// @post Every entry of A is stored.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T operator ()(uint32_t row_index, uint32_t column_index) const
+/// @brief Reads an entry.
+/// @pre Indices are in range, otherwise out_of_range is thrown.
+/// @post Returns the entry, 0 outside the envelope.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T * lower(uint32_t i)
+/// @fn T * upper(uint32_t i)
+/// @brief Start of the stored part of row i below the diagonal, and of
+///        column i above it. Entry k is column (or row) first(i) + k.
+///        upper() is lower() when symmetric is set.
+/// @pre i is in range.
+/// @post None.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SKYLINE_MATRIX_H
+#define SKYLINE_MATRIX_H
+
+#include <vector>
+#include "sparse_matrix.h"
+
+template <typename T>
+class SkylineMatrix
+{
+private:
+  uint32_t m_size;
+  bool m_symmetric;
+  vector<uint32_t> m_first;
+  // Row i's lower part and column i's upper part start at m_offset[i]
+  vector<size_t> m_offset;
+  vector<T> m_lower;
+  vector<T> m_upper;
+  vector<T> m_diagonal;
+
+public:
+  SkylineMatrix() : m_size(0), m_symmetric(false), m_offset(1, 0) {};
+  SkylineMatrix(const SparseMatrix<T>& A, bool symmetric);
+  SkylineMatrix(const SparseMatrix<T>& A, const vector<uint32_t>& order, bool symmetric);
+
+  // Getters
+  uint32_t getNumRows() const { return m_size; }
+  uint32_t getNumColumns() const { return m_size; }
+  bool symmetric() const { return m_symmetric; }
+  uint32_t first(uint32_t i) const { return m_first[i]; }
+  // Entries stored below the diagonal, the same number above it
+  size_t profile() const { return m_offset[m_size]; }
+  uint32_t bandwidth() const;
+
+  T * lower(uint32_t i) { return m_lower.data() + m_offset[i]; }
+  const T * lower(uint32_t i) const { return m_lower.data() + m_offset[i]; }
+  T * upper(uint32_t i) { return (m_symmetric ? m_lower.data() : m_upper.data()) + m_offset[i]; }
+  const T * upper(uint32_t i) const { return (m_symmetric ? m_lower.data() : m_upper.data()) + m_offset[i]; }
+  T * diagonal() { return m_diagonal.data(); }
+  const T * diagonal() const { return m_diagonal.data(); }
+
+  T operator ()(uint32_t row_index, uint32_t column_index) const;
+};
+
+#include "skyline_matrix.hpp"
+
+#endif //SKYLINE_MATRIX_H
@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////
+/// @file skyline_matrix.hpp
+/// @author Connor McBride
+/// @brief Contains the SkylineMatrix implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SKYLINE_MATRIX_HPP
+#define SKYLINE_MATRIX_HPP
+
+template <typename T>
+SkylineMatrix<T>::SkylineMatrix(const SparseMatrix<T>& A, bool symmetric)
+  : SkylineMatrix(A, vector<uint32_t>(), symmetric)
+{
+}
+
+template <typename T>
+SkylineMatrix<T>::SkylineMatrix(const SparseMatrix<T>& A, const vector<uint32_t>& order, bool symmetric)
+{
+  uint32_t n = A.getNumRows();
+  if(A.getNumColumns() != n)
+    throw domain_error("Matrix is not square: SkylineMatrix.");
+  if(!order.empty() && order.size() != n)
+    throw domain_error("Order size not compatible: SkylineMatrix.");
+  // An empty order is the identity
+  vector<uint32_t> position(n);
+  for(uint32_t k = 0; k < n; k++)
+    position[k] = k;
+  if(!order.empty())
+  {
+    vector<bool> seen(n, false);
+    for(uint32_t k = 0; k < n; k++)
+    {
+      if(order[k] >= n || seen[order[k]])
+        throw domain_error("Order is not a permutation: SkylineMatrix.");
+      seen[order[k]] = true;
+      position[order[k]] = k;
+    }
+  }
+
+  m_size = n;
+  m_symmetric = symmetric;
+  const uint32_t * row_start = A.rowStart();
+  const uint32_t * columns = A.columns();
+  const T * values = A.values();
+
+  // The envelope of row (and column) i reaches back to its furthest
+  // nonzero on either side of the diagonal
+  m_first.resize(n);
+  for(uint32_t i = 0; i < n; i++)
+    m_first[i] = i;
+  for(uint32_t r = 0; r < n; r++)
+    for(uint32_t e = row_start[r]; e < row_start[r + 1]; e++)
+    {
+      if(symmetric && columns[e] > r)
+        break;
+      uint32_t pr = position[r];
+      uint32_t pc = position[columns[e]];
+      uint32_t i = max(pr, pc);
+      m_first[i] = min(m_first[i], min(pr, pc));
+    }
+  m_offset.assign(1, 0);
+  for(uint32_t i = 0; i < n; i++)
+    m_offset.push_back(m_offset[i] + (i - m_first[i]));
+
+  m_lower.assign(m_offset[n], T(0));
+  m_upper.assign(symmetric ? 0 : m_offset[n], T(0));
+  m_diagonal.assign(n, T(0));
+  for(uint32_t r = 0; r < n; r++)
+    for(uint32_t e = row_start[r]; e < row_start[r + 1]; e++)
+    {
+      if(symmetric && columns[e] > r)
+        break;
+      uint32_t pr = position[r];
+      uint32_t pc = position[columns[e]];
+      if(pr == pc)
+        m_diagonal[pr] = values[e];
+      else if(pr > pc || symmetric)
+      {
+        uint32_t i = max(pr, pc);
+        lower(i)[min(pr, pc) - m_first[i]] = values[e];
+      }
+      else
+        upper(pc)[pr - m_first[pc]] = values[e];
+    }
+}
+
+template <typename T>
+uint32_t SkylineMatrix<T>::bandwidth() const
+{
+  uint32_t width = 0;
+  for(uint32_t i = 0; i < m_size; i++)
+    width = max(width, i - m_first[i]);
+  return width;
+}
+
+template <typename T>
+T SkylineMatrix<T>::operator ()(uint32_t row_index, uint32_t column_index) const
+{
+  if(row_index >= m_size || column_index >= m_size)
+    throw out_of_range("Index out of range: SkylineMatrix.");
+  if(row_index == column_index)
+    return m_diagonal[row_index];
+  if(row_index > column_index)
+    return column_index < m_first[row_index] ? T(0) : lower(row_index)[column_index - m_first[row_index]];
+  return row_index < m_first[column_index] ? T(0) : upper(column_index)[row_index - m_first[column_index]];
+}
+
+#endif //SKYLINE_MATRIX_HPP
@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////////////////////////
+/// @file sparse_matrix.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SparseMatrix class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SparseMatrix
+/// @brief Compressed sparse row matrix. Row i's nonzeros are
+///        values()[rowStart()[i]] up to values()[rowStart()[i + 1]],
+///        sorted by column. It is not a BaseMatrix since there are no
+///        rows to hand out as MathVectors.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SparseMatrix(const BaseMatrix<T>& A)
+/// @brief Keeps the nonzeros of A.
+/// @pre None.
+/// @post The object has A's size and holds every entry of A not equal to 0.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SparseMatrix(uint32_t m, uint32_t n, vector<uint32_t> row_start, vector<uint32_t> columns, vector<T> values)
+/// @brief Takes already compressed rows, for builders that never form
+///        a dense matrix.
+/// @pre row_start has m + 1 entries, columns are below n and sorted
+///      within each row, columns and values have row_start[m] entries.
+/// @post The object owns the three arrays.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T operator ()(uint32_t row_index, uint32_t column_index) const
+/// @brief Looks an entry up by binary search within its row.
+/// @pre Indices are in range, otherwise out_of_range is thrown.
+/// @post Returns the entry, 0 when it is not stored.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn int64_t find(uint32_t row_index, uint32_t column_index) const
+/// @brief Position of an entry in columns() and values().
+/// @pre Indices are in range.
+/// @post Returns the position, or -1 when the entry is not stored.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void gemv(T alpha, const SparseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+/// @brief y = alpha * A * x + beta * y, rows split across the shared pool.
+/// @pre A is m x n, x has n entries and y has m entries. y is not x.
+/// @post y holds the result.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include <vector>
+#include "../interfaces/base_matrix.h"
+#include "../utilities/thread_pool.h"
+
+template <typename T>
+class SparseMatrix
+{
+private:
+  uint32_t m_num_rows;
+  uint32_t m_num_columns;
+  vector<uint32_t> m_row_start;
+  vector<uint32_t> m_columns;
+  vector<T> m_values;
+
+public:
+  SparseMatrix() : m_num_rows(0), m_num_columns(0), m_row_start(1, 0) {};
+  SparseMatrix(const BaseMatrix<T>& A);
+  SparseMatrix(uint32_t m, uint32_t n, vector<uint32_t> row_start, vector<uint32_t> columns, vector<T> values);
+
+  // Getters
+  uint32_t getNumRows() const { return m_num_rows; }
+  uint32_t getNumColumns() const { return m_num_columns; }
+  uint32_t nonZeros() const { return m_values.size(); }
+  const uint32_t * rowStart() const { return m_row_start.data(); }
+  const uint32_t * columns() const { return m_columns.data(); }
+  const T * values() const { return m_values.data(); }
+  T * values() { return m_values.data(); }
+
+  T operator ()(uint32_t row_index, uint32_t column_index) const;
+  int64_t find(uint32_t row_index, uint32_t column_index) const;
+};
+
+template <typename T>
+void gemv(T alpha, const SparseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y);
+
+#include "sparse_matrix.hpp"
+
+#endif //SPARSE_MATRIX_H
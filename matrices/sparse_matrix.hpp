@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////
+/// @file sparse_matrix.hpp
+/// @author Connor McBride
+/// @brief Contains the SparseMatrix implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SPARSE_MATRIX_HPP
+#define SPARSE_MATRIX_HPP
+
+#include <algorithm>
+
+template <typename T>
+SparseMatrix<T>::SparseMatrix(const BaseMatrix<T>& A)
+{
+  m_num_rows = A.getNumRows();
+  m_num_columns = A.getNumColumns();
+  m_row_start.assign(1, 0);
+
+  for(uint32_t i = 0; i < m_num_rows; i++)
+  {
+    // Dense rows can be read directly, other layouts go through ()
+    if(A.type() == DENSE)
+    {
+      const T * row = A[i].data();
+      for(uint32_t j = 0; j < m_num_columns; j++)
+        if(row[j] != T(0))
+        {
+          m_columns.push_back(j);
+          m_values.push_back(row[j]);
+        }
+    }
+    else
+      for(uint32_t j = 0; j < m_num_columns; j++)
+      {
+        T element = A(i, j);
+        if(element != T(0))
+        {
+          m_columns.push_back(j);
+          m_values.push_back(element);
+        }
+      }
+    m_row_start.push_back(m_columns.size());
+  }
+}
+
+template <typename T>
+SparseMatrix<T>::SparseMatrix(uint32_t m, uint32_t n, vector<uint32_t> row_start, vector<uint32_t> columns, vector<T> values)
+{
+  if(row_start.size() != m + 1 || columns.size() != row_start[m] || values.size() != row_start[m])
+    throw domain_error("Compressed rows are inconsistent: SparseMatrix.");
+  m_num_rows = m;
+  m_num_columns = n;
+  m_row_start = move(row_start);
+  m_columns = move(columns);
+  m_values = move(values);
+}
+
+template <typename T>
+int64_t SparseMatrix<T>::find(uint32_t row_index, uint32_t column_index) const
+{
+  const uint32_t * begin = m_columns.data() + m_row_start[row_index];
+  const uint32_t * end = m_columns.data() + m_row_start[row_index + 1];
+  const uint32_t * it = lower_bound(begin, end, column_index);
+  if(it == end || *it != column_index)
+    return -1;
+  return it - m_columns.data();
+}
+
+template <typename T>
+T SparseMatrix<T>::operator ()(uint32_t row_index, uint32_t column_index) const
+{
+  if(row_index >= m_num_rows || column_index >= m_num_columns)
+    throw out_of_range("Index out of range: SparseMatrix.");
+  int64_t position = find(row_index, column_index);
+  return position < 0 ? T(0) : m_values[position];
+}
+
+template <typename T>
+void gemv(T alpha, const SparseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+{
+  uint32_t m = A.getNumRows();
+  if(x.size() != A.getNumColumns() || y.size() != m)
+    throw domain_error("Matrix sizes not compatible: gemv.");
+  if(&x == &y)
+    throw domain_error("Destination aliases the source: gemv.");
+
+  const uint32_t * row_start = A.rowStart();
+  const uint32_t * columns = A.columns();
+  const T * values = A.values();
+  const T * xs = x.data();
+  T * ys = y.data();
+  ThreadPool::shared().parallelFor(0, m, 4096, [=](uint32_t first, uint32_t last)
+  {
+    for(uint32_t i = first; i < last; i++)
+    {
+      T sum = 0;
+      for(uint32_t e = row_start[i]; e < row_start[i + 1]; e++)
+        sum += values[e] * xs[columns[e]];
+      ys[i] = alpha * sum + ((beta == T(0)) ? T(0) : beta * ys[i]);
+    }
+  });
+}
+
+#endif //SPARSE_MATRIX_HPP
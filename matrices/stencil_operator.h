@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////
+/// @file stencil_operator.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the StencilOperator3D class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class StencilOperator3D
+/// @brief Matrix free constant coefficient 7-point operator on an
+///        nx x ny x nz grid, point (x, y, z) being unknown
+///        (z * ny + y) * nx + x. Nothing but the coefficients is stored,
+///        so it scales to grids no sparse or dense matrix would fit.
+///        gemv sweeps the grid in tiles of y rows and z planes, so the
+///        planes above and below a row are still in cache when it is
+///        computed, with the tiles split across the shared pool. Any
+///        solver that only calls gemv takes it as its MATRIX.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn StencilOperator3D(uint32_t nx, uint32_t ny, uint32_t nz, T diagonal, T coupling_x, T coupling_y, T coupling_z)
+/// @brief Constructor.
+/// @pre None.
+/// @post Row p has diagonal at p and coupling_x (y, z) at its neighbours
+///       along x (y, z) that are inside the grid.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T operator ()(uint32_t row_index, uint32_t column_index) const
+/// @brief Works an entry out from the stencil.
+/// @pre Indices are in range, otherwise out_of_range is thrown.
+/// @post Returns the entry.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void gemv(T alpha, const StencilOperator3D<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+/// @brief y = alpha * A * x + beta * y, one tiled sweep of the grid.
+/// @pre x and y have one entry per grid point. y is not x.
+/// @post y holds the result.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef STENCIL_OPERATOR_H
+#define STENCIL_OPERATOR_H
+
+#include <vector>
+#include "../utilities/math_vector.h"
+#include "../utilities/thread_pool.h"
+
+template <typename T>
+class StencilOperator3D
+{
+private:
+  uint32_t m_nx;
+  uint32_t m_ny;
+  uint32_t m_nz;
+  T m_diagonal;
+  T m_coupling_x;
+  T m_coupling_y;
+  T m_coupling_z;
+
+public:
+  // Rows and planes in one tile of the sweep
+  static const uint32_t TILE_ROWS = 16;
+  static const uint32_t TILE_PLANES = 16;
+
+  StencilOperator3D() : m_nx(0), m_ny(0), m_nz(0), m_diagonal(0), m_coupling_x(0), m_coupling_y(0), m_coupling_z(0) {};
+  StencilOperator3D(uint32_t nx, uint32_t ny, uint32_t nz, T diagonal, T coupling_x, T coupling_y, T coupling_z)
+    : m_nx(nx), m_ny(ny), m_nz(nz), m_diagonal(diagonal),
+      m_coupling_x(coupling_x), m_coupling_y(coupling_y), m_coupling_z(coupling_z) {};
+
+  // Getters
+  uint32_t getNumRows() const { return m_nx * m_ny * m_nz; }
+  uint32_t getNumColumns() const { return m_nx * m_ny * m_nz; }
+  uint32_t nx() const { return m_nx; }
+  uint32_t ny() const { return m_ny; }
+  uint32_t nz() const { return m_nz; }
+  T diagonal() const { return m_diagonal; }
+  T couplingX() const { return m_coupling_x; }
+  T couplingY() const { return m_coupling_y; }
+  T couplingZ() const { return m_coupling_z; }
+
+  T operator ()(uint32_t row_index, uint32_t column_index) const;
+};
+
+template <typename T>
+void gemv(T alpha, const StencilOperator3D<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y);
+
+#include "stencil_operator.hpp"
+
+#endif //STENCIL_OPERATOR_H
@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////
+/// @file stencil_operator.hpp
+/// @author Connor McBride
+/// @brief Contains the StencilOperator3D implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef STENCIL_OPERATOR_HPP
+#define STENCIL_OPERATOR_HPP
+
+template <typename T>
+T StencilOperator3D<T>::operator ()(uint32_t row_index, uint32_t column_index) const
+{
+  if(row_index >= getNumRows() || column_index >= getNumColumns())
+    throw out_of_range("Index out of range: StencilOperator3D.");
+  uint32_t rx = row_index % m_nx;
+  uint32_t ry = (row_index / m_nx) % m_ny;
+  uint32_t rz = row_index / m_nx / m_ny;
+  uint32_t cx = column_index % m_nx;
+  uint32_t cy = (column_index / m_nx) % m_ny;
+  uint32_t cz = column_index / m_nx / m_ny;
+  uint32_t dx = rx > cx ? rx - cx : cx - rx;
+  uint32_t dy = ry > cy ? ry - cy : cy - ry;
+  uint32_t dz = rz > cz ? rz - cz : cz - rz;
+  if(dx + dy + dz == 0)
+    return m_diagonal;
+  if(dx + dy + dz > 1)
+    return T(0);
+  return dx == 1 ? m_coupling_x : (dy == 1 ? m_coupling_y : m_coupling_z);
+}
+
+template <typename T>
+void gemv(T alpha, const StencilOperator3D<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+{
+  uint32_t n = A.getNumRows();
+  if(x.size() != n || y.size() != n)
+    throw domain_error("Matrix sizes not compatible: gemv.");
+  if(&x == &y)
+    throw domain_error("Destination aliases the source: gemv.");
+  if(n == 0)
+    return;
+
+  uint32_t nx = A.nx();
+  uint32_t ny = A.ny();
+  uint32_t nz = A.nz();
+  size_t plane = size_t(nx) * ny;
+  T d = alpha * A.diagonal();
+  T cx = alpha * A.couplingX();
+  T cy = alpha * A.couplingY();
+  T cz = alpha * A.couplingZ();
+  const T * xs = x.data();
+  T * ys = y.data();
+  // Stands in for the rows beyond the faces of the grid
+  vector<T> zeros(nx, T(0));
+
+  const uint32_t tile_rows = StencilOperator3D<T>::TILE_ROWS;
+  const uint32_t tile_planes = StencilOperator3D<T>::TILE_PLANES;
+  uint32_t row_tiles = (ny + tile_rows - 1) / tile_rows;
+  uint32_t plane_tiles = (nz + tile_planes - 1) / tile_planes;
+  ThreadPool::shared().parallelFor(0, row_tiles * plane_tiles, 1, [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t t = first; t < last; t++)
+    {
+      uint32_t z0 = (t / row_tiles) * tile_planes;
+      uint32_t y0 = (t % row_tiles) * tile_rows;
+      for(uint32_t z = z0; z < min(nz, z0 + tile_planes); z++)
+        for(uint32_t r = y0; r < min(ny, y0 + tile_rows); r++)
+        {
+          size_t start = (size_t(z) * ny + r) * nx;
+          const T * c = xs + start;
+          const T * south = r > 0 ? c - nx : zeros.data();
+          const T * north = r + 1 < ny ? c + nx : zeros.data();
+          const T * below = z > 0 ? c - plane : zeros.data();
+          const T * above = z + 1 < nz ? c + plane : zeros.data();
+          T * out = ys + start;
+          auto value = [&](uint32_t i, T left, T right)
+          {
+            return d * c[i] + cx * (left + right) + cy * (south[i] + north[i]) + cz * (below[i] + above[i]);
+          };
+
+          // The ends of the row have one x neighbour, the rest two
+          if(nx == 1)
+          {
+            out[0] = value(0, T(0), T(0)) + ((beta == T(0)) ? T(0) : beta * out[0]);
+            continue;
+          }
+          T head = value(0, T(0), c[1]);
+          T tail = value(nx - 1, c[nx - 2], T(0));
+          if(beta == T(0))
+            for(uint32_t i = 1; i + 1 < nx; i++)
+              out[i] = value(i, c[i - 1], c[i + 1]);
+          else
+          {
+            head += beta * out[0];
+            tail += beta * out[nx - 1];
+            for(uint32_t i = 1; i + 1 < nx; i++)
+              out[i] = value(i, c[i - 1], c[i + 1]) + beta * out[i];
+          }
+          out[0] = head;
+          out[nx - 1] = tail;
+        }
+    }
+  });
+}
+
+#endif //STENCIL_OPERATOR_HPP
@@ -0,0 +1,113 @@
+//////////////////////////////////////////////////////////////////////
+/// @file tiled_matrix.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the TiledMatrix class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class TiledMatrix
+/// @brief Disk backed matrix for sizes that do not fit in memory. The
+///        file holds square tiles of tileSize() x tileSize() entries,
+///        tile (I, J) at position I * tileColumns() + J, each tile row
+///        major. Tiles on the bottom and right edges are zero padded to
+///        full size, so kernels never special case them. Only the tiles
+///        being worked on are ever in memory. It is not a BaseMatrix
+///        since there are no rows to hand out as MathVectors.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn TiledMatrix(const string& path, uint32_t rows, uint32_t columns, uint32_t tile, bool create)
+/// @brief Opens the backing file at path.
+/// @pre tile > 0. Without create the file must already hold a matrix of
+///      this size and tile size.
+/// @post With create the file is truncated to a zero matrix, which
+///       takes no disk space until tiles are written. Throws
+///       runtime_error if the file cannot be opened.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void readTile(uint32_t I, uint32_t J, DenseMatrix<T>& tile) const
+/// @brief Reads tile (I, J) with one vectored read.
+/// @pre I < tileRows(), J < tileColumns() and tile is tileSize() square.
+/// @post tile holds the padded tile. Throws runtime_error on I/O errors.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void writeTile(uint32_t I, uint32_t J, const DenseMatrix<T>& tile)
+/// @brief Writes tile (I, J) with one vectored write.
+/// @pre Same as readTile(). The padding of tile is zero.
+/// @post The file holds tile. Throws runtime_error on I/O errors.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void load(const DenseMatrix<T>& A)
+/// @brief Writes all of A, for matrices built in memory.
+/// @pre A has getNumRows() rows and getNumColumns() columns.
+/// @post The file holds A.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void store(DenseMatrix<T>& A) const
+/// @brief Reads the whole matrix back into memory.
+/// @pre It fits.
+/// @post A holds the matrix.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn static ThreadPool& io()
+/// @brief Single background thread every tile transfer is queued on.
+///        Having one thread keeps transfers in the order they were
+///        queued, so a read queued after a write of the same tile sees
+///        the write.
+/// @pre None.
+/// @return Returns the I/O pool.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TILED_MATRIX_H
+#define TILED_MATRIX_H
+
+#include <string>
+#include "dense_matrix.h"
+#include "../utilities/thread_pool.h"
+
+template <typename T>
+class TiledMatrix
+{
+private:
+  string m_path;
+  int m_fd;
+  uint32_t m_num_rows;
+  uint32_t m_num_columns;
+  uint32_t m_tile;
+  uint32_t m_tile_rows;
+  uint32_t m_tile_columns;
+
+  off_t offset(uint32_t I, uint32_t J) const;
+  void transfer(uint32_t I, uint32_t J, const DenseMatrix<T>& tile, bool write) const;
+
+public:
+  TiledMatrix(const string& path, uint32_t rows, uint32_t columns, uint32_t tile = 1024, bool create = true);
+  ~TiledMatrix();
+
+  TiledMatrix(const TiledMatrix&) = delete;
+  TiledMatrix& operator =(const TiledMatrix&) = delete;
+
+  uint32_t getNumRows() const { return m_num_rows; }
+  uint32_t getNumColumns() const { return m_num_columns; }
+  uint32_t tileSize() const { return m_tile; }
+  uint32_t tileRows() const { return m_tile_rows; }
+  uint32_t tileColumns() const { return m_tile_columns; }
+  const string& path() const { return m_path; }
+
+  void readTile(uint32_t I, uint32_t J, DenseMatrix<T>& tile) const;
+  void writeTile(uint32_t I, uint32_t J, const DenseMatrix<T>& tile);
+
+  void load(const DenseMatrix<T>& A);
+  void store(DenseMatrix<T>& A) const;
+
+  static ThreadPool& io();
+};
+
+#include "tiled_matrix.hpp"
+
+#endif //TILED_MATRIX_H
@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////
+/// @file tiled_matrix.hpp
+/// @author Connor McBride
+/// @brief Contains the TiledMatrix class implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TILED_MATRIX_HPP
+#define TILED_MATRIX_HPP
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/uio.h>
+#include <unistd.h>
+
+template <typename T>
+TiledMatrix<T>::TiledMatrix(const string& path, uint32_t rows, uint32_t columns, uint32_t tile, bool create)
+{
+  if(tile == 0)
+    throw domain_error("Tile size must be positive: TiledMatrix.");
+  m_path = path;
+  m_num_rows = rows;
+  m_num_columns = columns;
+  m_tile = tile;
+  m_tile_rows = (rows + tile - 1) / tile;
+  m_tile_columns = (columns + tile - 1) / tile;
+
+  m_fd = ::open(path.c_str(), O_RDWR | (create ? O_CREAT | O_TRUNC : 0), 0644);
+  if(m_fd < 0)
+    throw runtime_error("Could not open " + path + ": TiledMatrix.");
+  off_t bytes = offset(m_tile_rows, 0);
+  if(create && ::ftruncate(m_fd, bytes) < 0)
+  {
+    ::close(m_fd);
+    throw runtime_error("Could not size " + path + ": TiledMatrix.");
+  }
+  if(!create && ::lseek(m_fd, 0, SEEK_END) != bytes)
+  {
+    ::close(m_fd);
+    throw runtime_error("File size does not match the matrix: TiledMatrix.");
+  }
+}
+
+template <typename T>
+TiledMatrix<T>::~TiledMatrix()
+{
+  ::close(m_fd);
+}
+
+template <typename T>
+ThreadPool& TiledMatrix<T>::io()
+{
+  static ThreadPool pool(1);
+  return pool;
+}
+
+template <typename T>
+off_t TiledMatrix<T>::offset(uint32_t I, uint32_t J) const
+{
+  return (off_t(I) * m_tile_columns + J) * m_tile * m_tile * sizeof(T);
+}
+
+template <typename T>
+void TiledMatrix<T>::transfer(uint32_t I, uint32_t J, const DenseMatrix<T>& tile, bool write) const
+{
+  if(I >= m_tile_rows || J >= m_tile_columns)
+    throw out_of_range("Tile out of Range: TiledMatrix");
+  if(tile.getNumRows() != m_tile || tile.getNumColumns() != m_tile)
+    throw domain_error("Buffer is not one tile: TiledMatrix.");
+
+  // One iovec per tile row straight into the row's storage, batched up
+  // to the system limit per call
+  const uint32_t BATCH = IOV_MAX;
+  vector<iovec> rows(min(m_tile, BATCH));
+  size_t row_bytes = size_t(m_tile) * sizeof(T);
+  off_t at = offset(I, J);
+  for(uint32_t r0 = 0; r0 < m_tile; r0 += BATCH)
+  {
+    uint32_t count = min(m_tile - r0, BATCH);
+    for(uint32_t r = 0; r < count; r++)
+    {
+      rows[r].iov_base = tile[r0 + r].data();
+      rows[r].iov_len = row_bytes;
+    }
+
+    // Short transfers resume from the first unfinished row
+    size_t left = count * row_bytes;
+    iovec * next = rows.data();
+    while(left > 0)
+    {
+      ssize_t done = write ? ::pwritev(m_fd, next, count, at) : ::preadv(m_fd, next, count, at);
+      if(done < 0 && errno == EINTR)
+        continue;
+      if(done <= 0)
+        throw runtime_error("Tile transfer failed for " + m_path + ": TiledMatrix.");
+      at += done;
+      left -= done;
+      while(count > 0 && size_t(done) >= next->iov_len)
+      {
+        done -= next->iov_len;
+        next++;
+        count--;
+      }
+      if(count > 0)
+      {
+        next->iov_base = static_cast<char *>(next->iov_base) + done;
+        next->iov_len -= done;
+      }
+    }
+  }
+}
+
+template <typename T>
+void TiledMatrix<T>::readTile(uint32_t I, uint32_t J, DenseMatrix<T>& tile) const
+{
+  transfer(I, J, tile, false);
+}
+
+template <typename T>
+void TiledMatrix<T>::writeTile(uint32_t I, uint32_t J, const DenseMatrix<T>& tile)
+{
+  transfer(I, J, tile, true);
+}
+
+template <typename T>
+void TiledMatrix<T>::load(const DenseMatrix<T>& A)
+{
+  if(A.getNumRows() != m_num_rows || A.getNumColumns() != m_num_columns)
+    throw domain_error("Matrix size not compatible: TiledMatrix.");
+  DenseMatrix<T> tile(m_tile, m_tile);
+  for(uint32_t I = 0; I < m_tile_rows; I++)
+    for(uint32_t J = 0; J < m_tile_columns; J++)
+    {
+      uint32_t rows = min(m_tile, m_num_rows - I * m_tile);
+      uint32_t columns = min(m_tile, m_num_columns - J * m_tile);
+      if(rows < m_tile || columns < m_tile)
+        for(uint32_t r = 0; r < m_tile; r++)
+          fill(tile[r].data(), tile[r].data() + m_tile, T(0));
+      for(uint32_t r = 0; r < rows; r++)
+      {
+        const T * source = A[I * m_tile + r].data() + J * m_tile;
+        copy(source, source + columns, tile[r].data());
+      }
+      writeTile(I, J, tile);
+    }
+}
+
+template <typename T>
+void TiledMatrix<T>::store(DenseMatrix<T>& A) const
+{
+  A = DenseMatrix<T>(m_num_rows, m_num_columns);
+  DenseMatrix<T> tile(m_tile, m_tile);
+  for(uint32_t I = 0; I < m_tile_rows; I++)
+    for(uint32_t J = 0; J < m_tile_columns; J++)
+    {
+      readTile(I, J, tile);
+      uint32_t rows = min(m_tile, m_num_rows - I * m_tile);
+      uint32_t columns = min(m_tile, m_num_columns - J * m_tile);
+      for(uint32_t r = 0; r < rows; r++)
+        copy(tile[r].data(), tile[r].data() + columns, A[I * m_tile + r].data() + J * m_tile);
+    }
+}
+
+#endif //TILED_MATRIX_HPP
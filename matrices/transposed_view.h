@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////
+/// @file transposed_view.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the TransposedView class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class TransposedView
+/// @brief Non owning view of a matrix as its transpose. Nothing is
+///        copied: entry (i, j) reads entry (j, i) of the base, and the
+///        gemv/gemm overloads for views work straight off the base's
+///        rows. Iterative solvers and eigensolvers that only call gemv
+///        therefore work on A^T as they are.
+/// @pre The base outlives the view.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn TransposedView<MATRIX> transposed(const MATRIX& A)
+/// @brief Makes a view of A^T.
+/// @pre None.
+/// @return Returns the view.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TRANSPOSED_VIEW_H
+#define TRANSPOSED_VIEW_H
+
+#include <cstdint>
+
+template <class MATRIX>
+class TransposedView
+{
+private:
+  const MATRIX& m_base;
+
+public:
+  explicit TransposedView(const MATRIX& base) : m_base(base) {};
+
+  uint32_t getNumRows() const { return m_base.getNumColumns(); }
+  uint32_t getNumColumns() const { return m_base.getNumRows(); }
+  auto operator()(uint32_t row_index, uint32_t column_index) const { return m_base(column_index, row_index); }
+  const MATRIX& base() const { return m_base; }
+};
+
+template <class MATRIX>
+TransposedView<MATRIX> transposed(const MATRIX& A)
+{
+  return TransposedView<MATRIX>(A);
+}
+
+#endif //TRANSPOSED_VIEW_H
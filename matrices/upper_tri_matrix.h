@@ -80,6 +80,7 @@
 #define UPPER_TRI_MATRIX_H
 
 #include "../interfaces/base_matrix.h"
+#include "../utilities/blas.h"
 
 template <typename T>
 class UpperTriMatrix: public BaseMatrix<T>
@@ -89,6 +90,7 @@ public:
   UpperTriMatrix();
   UpperTriMatrix(const unique_ptr<BaseMatrix<T>> rhs);
   UpperTriMatrix(uint32_t n);
+  UpperTriMatrix(const UpperTriMatrix& other);
   UpperTriMatrix(UpperTriMatrix&& other);
   virtual ~UpperTriMatrix();
 
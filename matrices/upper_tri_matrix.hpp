@@ -54,6 +54,16 @@ UpperTriMatrix<T>::UpperTriMatrix(uint32_t n)
   }
 }
 
+template <typename T>
+UpperTriMatrix<T>::UpperTriMatrix(const UpperTriMatrix& other)
+{
+  this->m_num_rows = other.m_num_rows;
+  this->m_num_columns = other.m_num_columns;
+  this->m_vectors = new MathVector<T>[this->m_num_rows];
+  for(uint32_t i = 0; i < this->m_num_rows; i++)
+    this->m_vectors[i] = other.m_vectors[i];
+}
+
 template <typename T>
 UpperTriMatrix<T>::UpperTriMatrix(UpperTriMatrix&& other)
 {
@@ -136,9 +146,9 @@ UpperTriMatrix<T>& UpperTriMatrix<T>::operator =(UpperTriMatrix<T> other)
 template <typename T>
 UpperTriMatrix<T> UpperTriMatrix<T>::operator*(double c) const
 {
-  UpperTriMatrix<T> ret(this->clone());
+  UpperTriMatrix<T> ret(*this);
   for(uint32_t i = 0; i < ret.getNumRows(); i++)
-    ret[i] = c * ret[i];
+    scal(static_cast<T>(c), ret[i]);
   return ret;
 }
 
@@ -147,10 +157,10 @@ UpperTriMatrix<T> UpperTriMatrix<T>::operator+(const UpperTriMatrix<T>& rhs) con
 {
   if(this->m_num_columns != rhs.getNumColumns() || this->m_num_rows != rhs.getNumRows())
     throw domain_error("Sizes not equal : + UpperTriMatrix.");
-  UpperTriMatrix<T> ret(rhs.clone());
+  // Rows of both hold the same stored triangle, so they add directly
+  UpperTriMatrix<T> ret(*this);
   for(uint32_t i = 0; i < ret.getNumRows(); i++)
-    for(uint32_t j = i; j < ret.getNumColumns(); j++)
-      ret(i, j, ret(i, j) + (*this)(i, j));
+    ret[i] += rhs[i];
   return ret;
 }
 
@@ -160,11 +170,9 @@ UpperTriMatrix<T> UpperTriMatrix<T>::operator-(const UpperTriMatrix<T>& rhs) con
   if(this->m_num_columns != rhs.getNumColumns() || this->m_num_rows != rhs.getNumRows())
     throw domain_error("Sizes not equal : - UpperTriMatrix.");
 
-  UpperTriMatrix<T> ret(rhs.clone());
+  UpperTriMatrix<T> ret(*this);
   for(uint32_t i = 0; i < ret.getNumRows(); i++)
-    for(uint32_t j = i; j < ret.getNumColumns(); j++)
-      ret(i, j, -1 * ret(i, j) + (*this)(i, j));
-
+    ret[i] -= rhs[i];
   return ret;
 }
 
@@ -185,11 +193,7 @@ UpperTriMatrix<T> UpperTriMatrix<T>::operator*(const UpperTriMatrix<T>& rhs) con
 template <typename T>
 unique_ptr<BaseMatrix<T>> UpperTriMatrix<T>::clone() const
 {
-  unique_ptr<BaseMatrix<T>> ret = make_unique<UpperTriMatrix>(this->m_num_rows);
-  for(uint32_t i = 0; i < this->m_num_rows; i++)
-    (*ret)[i] = this->m_vectors[i];
-
-  return ret;
+  return make_unique<UpperTriMatrix<T>>(*this);
 }
 
 #endif //UPPER_TRI_MATRIX_HPP
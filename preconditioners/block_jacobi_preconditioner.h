@@ -0,0 +1,46 @@
+//////////////////////////////////////////////////////////////////////
+/// @file block_jacobi_preconditioner.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the BlockJacobiPreconditioner class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class BlockJacobiPreconditioner
+/// @brief M is the block diagonal of A with square blocks of
+///        block_size rows. Each block is LU factored once and the blocks
+///        are set up and applied in parallel.
+/// @pre Every diagonal block of A is nonsingular.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn BlockJacobiPreconditioner(uint32_t block_size)
+/// @brief Constructor.
+/// @pre block_size > 0.
+/// @post Blocks have block_size rows, the last one possibly fewer.
+/// @param1 Rows per block. A grid row of the Dirichlet operator is n - 1.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef BLOCK_JACOBI_PRECONDITIONER_H
+#define BLOCK_JACOBI_PRECONDITIONER_H
+
+#include "../interfaces/base_preconditioner.h"
+#include "../solvers/gaussian_solver.h"
+
+template <typename T>
+class BlockJacobiPreconditioner : public BasePreconditioner<T>
+{
+private:
+  uint32_t m_block_size;
+  uint32_t m_size;
+  vector<GaussianSolver::Factors<T>> m_blocks;
+
+public:
+  BlockJacobiPreconditioner(uint32_t block_size = 64) : m_block_size(block_size), m_size(0) {};
+
+  virtual void setup(const SparseMatrix<T>& A);
+  virtual void apply(const MathVector<T>& r, MathVector<T>& z) const;
+};
+
+#include "block_jacobi_preconditioner.hpp"
+
+#endif //BLOCK_JACOBI_PRECONDITIONER_H
@@ -0,0 +1,59 @@
+//////////////////////////////////////////////////////////////////////
+/// @file block_jacobi_preconditioner.hpp
+/// @author Connor McBride
+/// @brief Contains the BlockJacobiPreconditioner implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef BLOCK_JACOBI_PRECONDITIONER_HPP
+#define BLOCK_JACOBI_PRECONDITIONER_HPP
+
+template <typename T>
+void BlockJacobiPreconditioner<T>::setup(const SparseMatrix<T>& A)
+{
+  if(m_block_size == 0)
+    throw domain_error("Block size must be positive: BlockJacobiPreconditioner.");
+  m_size = A.getNumRows();
+  uint32_t count = (m_size + m_block_size - 1) / m_block_size;
+  m_blocks.assign(count, GaussianSolver::Factors<T>());
+
+  const uint32_t * row_start = A.rowStart();
+  const uint32_t * columns = A.columns();
+  const T * values = A.values();
+  ThreadPool::shared().parallelFor(0, count, 1, [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t b = first; b < last; b++)
+    {
+      uint32_t lo = b * m_block_size;
+      uint32_t hi = min(m_size, lo + m_block_size);
+      DenseMatrix<T> block(hi - lo, hi - lo);
+      for(uint32_t i = lo; i < hi; i++)
+        for(uint32_t e = row_start[i]; e < row_start[i + 1]; e++)
+          if(columns[e] >= lo && columns[e] < hi)
+            block[i - lo].data()[columns[e] - lo] = values[e];
+      GaussianSolver().factor(move(block), m_blocks[b]);
+    }
+  });
+}
+
+template <typename T>
+void BlockJacobiPreconditioner<T>::apply(const MathVector<T>& r, MathVector<T>& z) const
+{
+  const T * rs = r.data();
+  T * zs = z.data();
+  ThreadPool::shared().parallelFor(0, m_blocks.size(), 1, [&](uint32_t first, uint32_t last)
+  {
+    GaussianSolver solver;
+    for(uint32_t b = first; b < last; b++)
+    {
+      uint32_t lo = b * m_block_size;
+      uint32_t hi = min(m_size, lo + m_block_size);
+      MathVector<T> local(hi - lo);
+      for(uint32_t i = lo; i < hi; i++)
+        local.push(rs[i]);
+      solver.solve(m_blocks[b], local);
+      copy(local.data(), local.data() + (hi - lo), zs + lo);
+    }
+  });
+}
+
+#endif //BLOCK_JACOBI_PRECONDITIONER_HPP
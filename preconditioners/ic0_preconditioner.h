@@ -0,0 +1,40 @@
+//////////////////////////////////////////////////////////////////////
+/// @file ic0_preconditioner.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the IC0Preconditioner class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class IC0Preconditioner
+/// @brief Zero fill incomplete Cholesky. M = LL^T where L has exactly
+///        the nonzeros of the lower triangle of A, so it costs no more
+///        memory than A itself. apply() is one forward and one backward
+///        substitution.
+/// @pre A is symmetric positive definite with its diagonal stored.
+///      setup() throws domain_error if a pivot turns out non-positive,
+///      which can happen for matrices that are not M-matrices.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef IC0_PRECONDITIONER_H
+#define IC0_PRECONDITIONER_H
+
+#include <cmath>
+#include "../interfaces/base_preconditioner.h"
+
+template <typename T>
+class IC0Preconditioner : public BasePreconditioner<T>
+{
+private:
+  // Lower triangle by row, the diagonal last in every row
+  vector<uint32_t> m_row_start;
+  vector<uint32_t> m_columns;
+  vector<T> m_values;
+
+public:
+  virtual void setup(const SparseMatrix<T>& A);
+  virtual void apply(const MathVector<T>& r, MathVector<T>& z) const;
+};
+
+#include "ic0_preconditioner.hpp"
+
+#endif //IC0_PRECONDITIONER_H
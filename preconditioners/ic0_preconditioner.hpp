@@ -0,0 +1,94 @@
+//////////////////////////////////////////////////////////////////////
+/// @file ic0_preconditioner.hpp
+/// @author Connor McBride
+/// @brief Contains the IC0Preconditioner implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef IC0_PRECONDITIONER_HPP
+#define IC0_PRECONDITIONER_HPP
+
+template <typename T>
+void IC0Preconditioner<T>::setup(const SparseMatrix<T>& A)
+{
+  uint32_t n = A.getNumRows();
+  const uint32_t * row_start = A.rowStart();
+  const uint32_t * columns = A.columns();
+  const T * values = A.values();
+
+  m_row_start.assign(1, 0);
+  m_columns.clear();
+  m_values.clear();
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t e = row_start[i]; e < row_start[i + 1] && columns[e] <= i; e++)
+    {
+      m_columns.push_back(columns[e]);
+      m_values.push_back(values[e]);
+    }
+    if(m_columns.size() == m_row_start.back() || m_columns.back() != i)
+      throw domain_error("Diagonal entry missing: IC0Preconditioner.");
+    m_row_start.push_back(m_columns.size());
+  }
+
+  // Row i of L only needs finished rows k < i, so the rows go in order
+  for(uint32_t i = 0; i < n; i++)
+  {
+    uint32_t diagonal = m_row_start[i + 1] - 1;
+    for(uint32_t e = m_row_start[i]; e < diagonal; e++)
+    {
+      // L(i,k) = (A(i,k) - sum over j < k of L(i,j) L(k,j)) / L(k,k),
+      // walking the sorted columns of rows i and k together
+      uint32_t k = m_columns[e];
+      uint32_t k_diagonal = m_row_start[k + 1] - 1;
+      uint32_t a = m_row_start[i];
+      uint32_t b = m_row_start[k];
+      T sum = m_values[e];
+      while(a < e && b < k_diagonal)
+      {
+        if(m_columns[a] < m_columns[b])
+          a++;
+        else if(m_columns[a] > m_columns[b])
+          b++;
+        else
+          sum -= m_values[a++] * m_values[b++];
+      }
+      m_values[e] = sum / m_values[k_diagonal];
+    }
+
+    T pivot = m_values[diagonal];
+    for(uint32_t e = m_row_start[i]; e < diagonal; e++)
+      pivot -= m_values[e] * m_values[e];
+    if(!(pivot > T(0)))
+      throw domain_error("Non-positive pivot: IC0Preconditioner.");
+    m_values[diagonal] = sqrt(pivot);
+  }
+}
+
+template <typename T>
+void IC0Preconditioner<T>::apply(const MathVector<T>& r, MathVector<T>& z) const
+{
+  uint32_t n = m_row_start.size() - 1;
+  const T * rs = r.data();
+  T * zs = z.data();
+
+  // L y = r
+  for(uint32_t i = 0; i < n; i++)
+  {
+    uint32_t diagonal = m_row_start[i + 1] - 1;
+    T sum = rs[i];
+    for(uint32_t e = m_row_start[i]; e < diagonal; e++)
+      sum -= m_values[e] * zs[m_columns[e]];
+    zs[i] = sum / m_values[diagonal];
+  }
+
+  // L^T z = y, pushing each finished entry up its row of L
+  for(int32_t i = n - 1; i >= 0; i--)
+  {
+    uint32_t diagonal = m_row_start[i + 1] - 1;
+    zs[i] /= m_values[diagonal];
+    for(uint32_t e = m_row_start[i]; e < diagonal; e++)
+      zs[m_columns[e]] -= m_values[e] * zs[i];
+  }
+}
+
+#endif //IC0_PRECONDITIONER_HPP
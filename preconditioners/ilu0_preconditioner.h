@@ -0,0 +1,35 @@
+//////////////////////////////////////////////////////////////////////
+/// @file ilu0_preconditioner.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the ILU0Preconditioner class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class ILU0Preconditioner
+/// @brief Zero fill incomplete LU. M = LU where L (unit diagonal) and U
+///        share exactly the nonzeros of A, stored in one copy of A's
+///        rows like GaussianSolver's LU. Works for nonsymmetric A.
+/// @pre A has its diagonal stored. setup() throws domain_error if a
+///      pivot comes out zero. No pivoting is done.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef ILU0_PRECONDITIONER_H
+#define ILU0_PRECONDITIONER_H
+
+#include "../interfaces/base_preconditioner.h"
+
+template <typename T>
+class ILU0Preconditioner : public BasePreconditioner<T>
+{
+private:
+  SparseMatrix<T> m_lu;
+  vector<uint32_t> m_diagonal;
+
+public:
+  virtual void setup(const SparseMatrix<T>& A);
+  virtual void apply(const MathVector<T>& r, MathVector<T>& z) const;
+};
+
+#include "ilu0_preconditioner.hpp"
+
+#endif //ILU0_PRECONDITIONER_H
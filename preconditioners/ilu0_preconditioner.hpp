@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////
+/// @file ilu0_preconditioner.hpp
+/// @author Connor McBride
+/// @brief Contains the ILU0Preconditioner implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef ILU0_PRECONDITIONER_HPP
+#define ILU0_PRECONDITIONER_HPP
+
+template <typename T>
+void ILU0Preconditioner<T>::setup(const SparseMatrix<T>& A)
+{
+  uint32_t n = A.getNumRows();
+  m_lu = A;
+  m_diagonal.assign(n, 0);
+  const uint32_t * row_start = m_lu.rowStart();
+  const uint32_t * columns = m_lu.columns();
+  T * values = m_lu.values();
+
+  for(uint32_t i = 0; i < n; i++)
+  {
+    int64_t position = m_lu.find(i, i);
+    if(position < 0)
+      throw domain_error("Diagonal entry missing: ILU0Preconditioner.");
+    m_diagonal[i] = position;
+  }
+
+  // Row by row elimination (the IKJ order), dropping any update that
+  // falls outside the pattern of row i. where[j] is the position of
+  // column j in row i, or -1.
+  vector<int64_t> where(n, -1);
+  for(uint32_t i = 0; i < n; i++)
+  {
+    for(uint32_t e = row_start[i]; e < row_start[i + 1]; e++)
+      where[columns[e]] = e;
+
+    for(uint32_t e = row_start[i]; e < m_diagonal[i]; e++)
+    {
+      uint32_t k = columns[e];
+      values[e] /= values[m_diagonal[k]];
+      for(uint32_t f = m_diagonal[k] + 1; f < row_start[k + 1]; f++)
+        if(where[columns[f]] >= 0)
+          values[where[columns[f]]] -= values[e] * values[f];
+    }
+
+    for(uint32_t e = row_start[i]; e < row_start[i + 1]; e++)
+      where[columns[e]] = -1;
+    if(values[m_diagonal[i]] == T(0))
+      throw domain_error("Zero pivot: ILU0Preconditioner.");
+  }
+}
+
+template <typename T>
+void ILU0Preconditioner<T>::apply(const MathVector<T>& r, MathVector<T>& z) const
+{
+  uint32_t n = m_lu.getNumRows();
+  const uint32_t * row_start = m_lu.rowStart();
+  const uint32_t * columns = m_lu.columns();
+  const T * values = m_lu.values();
+  const T * rs = r.data();
+  T * zs = z.data();
+
+  // Unit L
+  for(uint32_t i = 0; i < n; i++)
+  {
+    T sum = rs[i];
+    for(uint32_t e = row_start[i]; e < m_diagonal[i]; e++)
+      sum -= values[e] * zs[columns[e]];
+    zs[i] = sum;
+  }
+
+  // U
+  for(int32_t i = n - 1; i >= 0; i--)
+  {
+    T sum = zs[i];
+    for(uint32_t e = m_diagonal[i] + 1; e < row_start[i + 1]; e++)
+      sum -= values[e] * zs[columns[e]];
+    zs[i] = sum / values[m_diagonal[i]];
+  }
+}
+
+#endif //ILU0_PRECONDITIONER_HPP
@@ -0,0 +1,32 @@
+//////////////////////////////////////////////////////////////////////
+/// @file jacobi_preconditioner.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the JacobiPreconditioner class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class JacobiPreconditioner
+/// @brief M is the diagonal of A. apply() is one multiply per entry,
+///        split across the shared pool.
+/// @pre A has no zeros on its diagonal.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef JACOBI_PRECONDITIONER_H
+#define JACOBI_PRECONDITIONER_H
+
+#include "../interfaces/base_preconditioner.h"
+
+template <typename T>
+class JacobiPreconditioner : public BasePreconditioner<T>
+{
+private:
+  vector<T> m_inverse_diagonal;
+
+public:
+  virtual void setup(const SparseMatrix<T>& A);
+  virtual void apply(const MathVector<T>& r, MathVector<T>& z) const;
+};
+
+#include "jacobi_preconditioner.hpp"
+
+#endif //JACOBI_PRECONDITIONER_H
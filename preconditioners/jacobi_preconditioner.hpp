@@ -0,0 +1,37 @@
+//////////////////////////////////////////////////////////////////////
+/// @file jacobi_preconditioner.hpp
+/// @author Connor McBride
+/// @brief Contains the JacobiPreconditioner implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef JACOBI_PRECONDITIONER_HPP
+#define JACOBI_PRECONDITIONER_HPP
+
+template <typename T>
+void JacobiPreconditioner<T>::setup(const SparseMatrix<T>& A)
+{
+  uint32_t n = A.getNumRows();
+  m_inverse_diagonal.assign(n, T(0));
+  for(uint32_t i = 0; i < n; i++)
+  {
+    T d = A(i, i);
+    if(d == T(0))
+      throw domain_error("Zero on the diagonal: JacobiPreconditioner.");
+    m_inverse_diagonal[i] = T(1) / d;
+  }
+}
+
+template <typename T>
+void JacobiPreconditioner<T>::apply(const MathVector<T>& r, MathVector<T>& z) const
+{
+  const T * rs = r.data();
+  T * zs = z.data();
+  const T * d = m_inverse_diagonal.data();
+  ThreadPool::shared().parallelFor(0, m_inverse_diagonal.size(), 1 << 14, [=](uint32_t first, uint32_t last)
+  {
+    for(uint32_t i = first; i < last; i++)
+      zs[i] = d[i] * rs[i];
+  });
+}
+
+#endif //JACOBI_PRECONDITIONER_HPP
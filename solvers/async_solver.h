@@ -0,0 +1,133 @@
+//////////////////////////////////////////////////////////////////////
+/// @file async_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the AsyncSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class AsyncSolver
+/// @brief Front end that queues solves on the shared ThreadPool and
+///        hands back futures. Independent systems run concurrently, and
+///        the caller can assemble the next system while earlier ones
+///        are being solved. At most max_in_flight solves are queued or
+///        running at once; submit() blocks past that, so a loop over
+///        thousands of systems never holds more than that many in memory.
+/// @pre SOLVER must provide Factors<T>, factor() and solve() like
+///      GaussianSolver does, and be copyable. Each task works on its own
+///      copy, so solvers that keep per-solve state stay safe.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn AsyncSolver(const SOLVER& solver, uint32_t max_in_flight)
+/// @brief Constructor.
+/// @pre None.
+/// @post max_in_flight 0 means twice the number of pool workers.
+/// @param1 Solver copied into every task.
+/// @param2 Bound on the solves queued or running at once.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn ~AsyncSolver()
+/// @brief Destructor.
+/// @pre None.
+/// @post Every submitted solve has finished.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn future<MathVector<T>> submit(DenseMatrix<T> A, MathVector<T> b)
+/// @brief Queues the factor and solve of Ax = b. Pass temporaries or
+///        move to avoid copying A.
+/// @pre A is n x n and b has n entries.
+/// @post The solve runs on a worker.
+/// @return Returns the future x. Errors from the solver are rethrown
+///         by get().
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn future<MathVector<T>> submit(F assemble)
+/// @brief Queues assemble(A, b) followed by the solve, so assembly of
+///        one system overlaps with the solves of the others.
+/// @pre assemble is callable as assemble(DenseMatrix<T>&, MathVector<T>&)
+///      and safe to run concurrently with itself.
+/// @post Both steps run on one worker.
+/// @return Returns the future x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const DenseMatrix<T>& A)
+/// @brief Factors A on the calling thread and keeps the factors for
+///        solve(), for a fixed operator like DirichletSolver's.
+/// @pre A is n x n.
+/// @post Later solve() calls use these factors. Solves already queued
+///       keep the factors they were submitted with.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn future<MathVector<T>> solve(MathVector<T> b)
+/// @brief Queues a solve with the factors from factor().
+/// @pre factor() has been called and b has n entries.
+/// @post The solve runs on a worker.
+/// @return Returns the future x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void wait()
+/// @brief Blocks until every submitted solve has finished.
+/// @pre None.
+/// @post inFlight() is 0 unless another thread submitted meanwhile.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include "../matrices/dense_matrix.h"
+#include "gaussian_solver.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
+
+template <typename T, class SOLVER = GaussianSolver>
+class AsyncSolver
+{
+private:
+  typedef typename SOLVER::template Factors<T> Factors;
+
+  // Shared with the tasks, which may finish after the solver is gone
+  struct Slots
+  {
+    mutex lock;
+    condition_variable released;
+    uint32_t in_flight;
+    Slots() : in_flight(0) {}
+  };
+
+  SOLVER m_solver;
+  uint32_t m_max_in_flight;
+  shared_ptr<Slots> m_slots;
+  shared_ptr<const Factors> m_factors;
+
+  void acquire();
+  template <class F>
+  future<MathVector<T>> queue(F task);
+
+public:
+  AsyncSolver(const SOLVER& solver = SOLVER(), uint32_t max_in_flight = 0);
+  ~AsyncSolver() { wait(); }
+
+  AsyncSolver(const AsyncSolver&) = delete;
+  AsyncSolver& operator =(const AsyncSolver&) = delete;
+
+  future<MathVector<T>> submit(DenseMatrix<T> A, MathVector<T> b);
+  template <class F>
+  future<MathVector<T>> submit(F assemble);
+
+  void factor(const DenseMatrix<T>& A);
+  future<MathVector<T>> solve(MathVector<T> b);
+
+  void wait();
+  uint32_t inFlight() const;
+};
+
+#include "async_solver.hpp"
@@ -0,0 +1,115 @@
+#pragma once
+
+template <typename T, class SOLVER>
+AsyncSolver<T, SOLVER>::AsyncSolver(const SOLVER& solver, uint32_t max_in_flight)
+  : m_solver(solver), m_max_in_flight(max_in_flight), m_slots(make_shared<Slots>())
+{
+  if(m_max_in_flight == 0)
+    m_max_in_flight = 2 * ThreadPool::shared().size();
+}
+
+template <typename T, class SOLVER>
+void AsyncSolver<T, SOLVER>::acquire()
+{
+  unique_lock<mutex> lock(m_slots->lock);
+  m_slots->released.wait(lock, [this] { return m_slots->in_flight < m_max_in_flight; });
+  m_slots->in_flight++;
+}
+
+template <typename T, class SOLVER>
+template <class F>
+future<MathVector<T>> AsyncSolver<T, SOLVER>::queue(F task)
+{
+  acquire();
+  shared_ptr<Slots> slots = m_slots;
+
+  // The slot is given back even when the task throws; the exception
+  // itself travels to the caller through the future
+  return ThreadPool::shared().submit([slots, task]() mutable
+  {
+    struct Release
+    {
+      Slots& slots;
+      ~Release()
+      {
+        lock_guard<mutex> lock(slots.lock);
+        slots.in_flight--;
+        slots.released.notify_all();
+      }
+    } release{*slots};
+    return task();
+  });
+}
+
+template <typename T, class SOLVER>
+future<MathVector<T>> AsyncSolver<T, SOLVER>::submit(DenseMatrix<T> A, MathVector<T> b)
+{
+  SOLVER solver = m_solver;
+  return queue([solver, A = move(A), b = move(b)]() mutable
+  {
+    TraceSpan span("AsyncSolver::solve");
+    Factors f;
+    solver.factor(A, f);
+    solver.solve(f, b);
+    return b;
+  });
+}
+
+template <typename T, class SOLVER>
+template <class F>
+future<MathVector<T>> AsyncSolver<T, SOLVER>::submit(F assemble)
+{
+  SOLVER solver = m_solver;
+  return queue([solver, assemble]() mutable
+  {
+    DenseMatrix<T> A;
+    MathVector<T> b;
+    {
+      TraceSpan span("AsyncSolver::assemble");
+      assemble(A, b);
+    }
+    TraceSpan span("AsyncSolver::solve");
+    Factors f;
+    solver.factor(A, f);
+    solver.solve(f, b);
+    return b;
+  });
+}
+
+template <typename T, class SOLVER>
+void AsyncSolver<T, SOLVER>::factor(const DenseMatrix<T>& A)
+{
+  TraceSpan span("AsyncSolver::factor");
+  shared_ptr<Factors> f = make_shared<Factors>();
+  m_solver.factor(A, *f);
+  m_factors = f;
+}
+
+template <typename T, class SOLVER>
+future<MathVector<T>> AsyncSolver<T, SOLVER>::solve(MathVector<T> b)
+{
+  if(!m_factors)
+    throw domain_error("No factors to solve with: AsyncSolver.");
+  SOLVER solver = m_solver;
+  shared_ptr<const Factors> factors = m_factors;
+  return queue([solver, factors, b = move(b)]() mutable
+  {
+    TraceSpan span("AsyncSolver::solve");
+    solver.solve(*factors, b);
+    return b;
+  });
+}
+
+template <typename T, class SOLVER>
+void AsyncSolver<T, SOLVER>::wait()
+{
+  unique_lock<mutex> lock(m_slots->lock);
+  m_slots->released.wait(lock, [this] { return m_slots->in_flight == 0; });
+}
+
+template <typename T, class SOLVER>
+uint32_t AsyncSolver<T, SOLVER>::inFlight() const
+{
+  lock_guard<mutex> lock(m_slots->lock);
+  return m_slots->in_flight;
+}
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////
+/// @file batched_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the BatchedSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class BatchedSolver
+/// @brief Solves batch independent n x n systems at once. The systems are
+///        stored interleaved (structure of arrays): element (i, j) of every
+///        system is contiguous, so each step of the elimination is one
+///        vectorizable loop over the batch. Chunks of the batch are spread
+///        over the shared ThreadPool.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn BatchedSolver(uint32_t n, uint32_t batch)
+/// @brief Constructor for batch systems of size n x n.
+/// @pre n > 0.
+/// @post Buffers of matrixSize() and vectorSize() elements describe the batch.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn size_t matrixIndex(uint32_t i, uint32_t j, uint32_t s) const
+/// @brief Offset of element (i, j) of system s in the matrix buffer.
+/// @pre i, j < n and s < batch.
+/// @return Returns (i * n + j) * batch + s.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn size_t vectorIndex(uint32_t i, uint32_t s) const
+/// @brief Offset of entry i of system s in the right hand side buffer.
+/// @pre i < n and s < batch.
+/// @return Returns i * batch + s.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void load(uint32_t s, const DenseMatrix<T>& m, const MathVector<T>& v, T * A, T * b) const
+/// @brief Copies a system into slot s of the interleaved buffers.
+/// @pre m is n x n, v has n entries and s < batch.
+/// @post Slot s of A and b holds m and v.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> unload(uint32_t s, const T * b) const
+/// @brief Copies slot s of an interleaved vector buffer out.
+/// @pre s < batch.
+/// @return Returns the n entries of system s.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void operator ()(T * A, T * b) const
+/// @brief Solves every system in place with per-system partial pivoting.
+/// @pre A holds matrixSize() and b vectorSize() elements in the layout above.
+/// @post b holds the solutions and A is overwritten with the factors.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include "../matrices/dense_matrix.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
+
+class BatchedSolver
+{
+private:
+  uint32_t m_n;
+  uint32_t m_batch;
+
+  // Systems handed to one thread at a time, and therefore the vector length
+  static const uint32_t CHUNK = 256;
+
+  template <typename T>
+  void solveChunk(T * A, T * b, uint32_t first, uint32_t last) const;
+
+public:
+  BatchedSolver(uint32_t n, uint32_t batch) : m_n(n), m_batch(batch) {};
+
+  size_t matrixSize() const { return static_cast<size_t>(m_n) * m_n * m_batch; }
+  size_t vectorSize() const { return static_cast<size_t>(m_n) * m_batch; }
+  size_t matrixIndex(uint32_t i, uint32_t j, uint32_t s) const
+  {
+    return (static_cast<size_t>(i) * m_n + j) * m_batch + s;
+  }
+  size_t vectorIndex(uint32_t i, uint32_t s) const { return static_cast<size_t>(i) * m_batch + s; }
+
+  template <typename T>
+  void load(uint32_t s, const DenseMatrix<T>& m, const MathVector<T>& v, T * A, T * b) const;
+  template <typename T>
+  MathVector<T> unload(uint32_t s, const T * b) const;
+
+  template <typename T>
+  void operator()(T * A, T * b) const;
+};
+
+#include "batched_solver.hpp"
@@ -0,0 +1,111 @@
+#pragma once
+
+template <typename T>
+void BatchedSolver::load(uint32_t s, const DenseMatrix<T>& m, const MathVector<T>& v, T * A, T * b) const
+{
+  for(uint32_t i = 0; i < m_n; i++)
+  {
+    const T * row = m[i].data();
+    for(uint32_t j = 0; j < m_n; j++)
+      A[matrixIndex(i, j, s)] = row[j];
+    b[vectorIndex(i, s)] = v.data()[i];
+  }
+}
+
+template <typename T>
+MathVector<T> BatchedSolver::unload(uint32_t s, const T * b) const
+{
+  MathVector<T> ret(m_n);
+  for(uint32_t i = 0; i < m_n; i++)
+    ret.push(b[vectorIndex(i, s)]);
+  return ret;
+}
+
+template <typename T>
+void BatchedSolver::operator()(T * A, T * b) const
+{
+  TraceSpan span("BatchedSolver::solve");
+  ThreadPool::shared().parallelFor(0, m_batch, CHUNK, [this, A, b](uint32_t first, uint32_t last)
+  {
+    solveChunk(A, b, first, last);
+  });
+}
+
+template <typename T>
+void BatchedSolver::solveChunk(T * A, T * b, uint32_t first, uint32_t last) const
+{
+  const uint32_t n = m_n;
+  const uint32_t lanes = last - first;
+  const size_t row_stride = static_cast<size_t>(n) * m_batch;
+  uint32_t pivot[CHUNK];
+  T best[CHUNK];
+
+  // Every loop over s below does the same work for each system in the
+  // chunk, which is what lets the compiler vectorize across the batch.
+  for(uint32_t j = 0; j < n; j++)
+  {
+    // Pick the pivot row of column j for each system
+    const T * a_jj = A + matrixIndex(j, j, first);
+    for(uint32_t s = 0; s < lanes; s++)
+    {
+      pivot[s] = j;
+      best[s] = fabs(a_jj[s]);
+    }
+    for(uint32_t i = j + 1; i < n; i++)
+    {
+      const T * a_ij = A + matrixIndex(i, j, first);
+      for(uint32_t s = 0; s < lanes; s++)
+      {
+        T value = fabs(a_ij[s]);
+        bool larger = value > best[s];
+        best[s] = larger ? value : best[s];
+        pivot[s] = larger ? i : pivot[s];
+      }
+    }
+
+    // Swap row j with each system's pivot row
+    for(uint32_t k = 0; k < n; k++)
+    {
+      T * a_jk = A + matrixIndex(j, k, first);
+      for(uint32_t s = 0; s < lanes; s++)
+        swap(a_jk[s], a_jk[(pivot[s] - j) * row_stride + s]);
+    }
+    T * b_j = b + vectorIndex(j, first);
+    for(uint32_t s = 0; s < lanes; s++)
+      swap(b_j[s], b_j[(pivot[s] - j) * static_cast<size_t>(m_batch) + s]);
+
+    // Eliminate below the pivot, keeping the multipliers in place
+    for(uint32_t i = j + 1; i < n; i++)
+    {
+      T * a_ij = A + matrixIndex(i, j, first);
+      T * b_i = b + vectorIndex(i, first);
+      for(uint32_t s = 0; s < lanes; s++)
+        a_ij[s] /= a_jj[s];
+      for(uint32_t k = j + 1; k < n; k++)
+      {
+        T * a_ik = A + matrixIndex(i, k, first);
+        const T * a_jk = A + matrixIndex(j, k, first);
+        for(uint32_t s = 0; s < lanes; s++)
+          a_ik[s] -= a_ij[s] * a_jk[s];
+      }
+      for(uint32_t s = 0; s < lanes; s++)
+        b_i[s] -= a_ij[s] * b_j[s];
+    }
+  }
+
+  // Back substitute
+  for(int32_t i = n - 1; i >= 0; i--)
+  {
+    T * b_i = b + vectorIndex(i, first);
+    for(uint32_t k = i + 1; k < n; k++)
+    {
+      const T * a_ik = A + matrixIndex(i, k, first);
+      const T * b_k = b + vectorIndex(k, first);
+      for(uint32_t s = 0; s < lanes; s++)
+        b_i[s] -= a_ik[s] * b_k[s];
+    }
+    const T * a_ii = A + matrixIndex(i, i, first);
+    for(uint32_t s = 0; s < lanes; s++)
+      b_i[s] /= a_ii[s];
+  }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+template <template <typename> class PRECONDITIONER>
+template <typename T, class MATRIX>
+MathVector<T> BiCGSTABSolver<PRECONDITIONER>::operator()(const MATRIX& A, const MathVector<T>& b)
+{
+  MathVector<T> x = b;
+
+  if constexpr(is_same<MATRIX, DenseMatrix<T>>::value || is_same<MATRIX, SparseMatrix<T>>::value)
+  {
+    Factors<T> f;
+    factor(A, f);
+    solve(f, x);
+  }
+  else
+    solve(A, static_cast<const BasePreconditioner<T> *>(nullptr), x);
+
+  return x;
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void BiCGSTABSolver<PRECONDITIONER>::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  factor(SparseMatrix<T>(A), f);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void BiCGSTABSolver<PRECONDITIONER>::factor(const SparseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("BiCGSTABSolver::factor");
+  if(A.getNumRows() != A.getNumColumns())
+    throw domain_error("Matrix must be square: BiCGSTABSolver.");
+  f.A = A;
+  f.M.setup(f.A);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void BiCGSTABSolver<PRECONDITIONER>::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  solve(f.A, static_cast<const BasePreconditioner<T> *>(&f.M), b);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T, class MATRIX>
+void BiCGSTABSolver<PRECONDITIONER>::solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b)
+{
+  TraceSpan span("BiCGSTABSolver::solve");
+  uint32_t n = A.getNumRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: BiCGSTABSolver.");
+
+  // Copies of b give vectors of the right size to work in
+  MathVector<T> x = b;
+  MathVector<T> r = b;
+  MathVector<T> r_hat = b;
+  MathVector<T> p = b;
+  MathVector<T> p_hat = b;
+  MathVector<T> v = b;
+  MathVector<T> s_hat = b;
+  MathVector<T> t = b;
+  fill(x.data(), x.data() + n, T(0));
+  fill(p.data(), p.data() + n, T(0));
+  fill(v.data(), v.data() + n, T(0));
+
+  T norm_b = sqrt(b * b);
+  T rho = 1;
+  T alpha = 1;
+  T omega = 1;
+  m_iterations = 0;
+  while(norm_b > T(0) && m_iterations < m_max_iterations)
+  {
+    TraceSpan iteration_span("BiCGSTABSolver::iteration");
+    T rho_next = r_hat * r;
+    if(rho_next == T(0) || omega == T(0))
+      throw domain_error("Method broke down: BiCGSTABSolver.");
+
+    // p = r + beta (p - omega v)
+    T beta = (rho_next / rho) * (alpha / omega);
+    rho = rho_next;
+    T * ps = p.data();
+    const T * rs = r.data();
+    const T * vs = v.data();
+    for(uint32_t i = 0; i < n; i++)
+      ps[i] = rs[i] + beta * (ps[i] - omega * vs[i]);
+
+    if(M != nullptr)
+      M->apply(p, p_hat);
+    else
+      p_hat = p;
+    gemv(T(1), A, p_hat, T(0), v);
+    alpha = rho / (r_hat * v);
+
+    // r becomes s = r - alpha v
+    axpy(alpha, p_hat, x);
+    axpy(-alpha, v, r);
+    m_iterations++;
+    if(sqrt(r * r) <= m_tolerance * norm_b)
+      break;
+
+    if(M != nullptr)
+      M->apply(r, s_hat);
+    else
+      s_hat = r;
+    gemv(T(1), A, s_hat, T(0), t);
+    T tt = t * t;
+    omega = tt == T(0) ? T(0) : (t * r) / tt;
+    axpy(omega, s_hat, x);
+    axpy(-omega, t, r);
+    if(sqrt(r * r) <= m_tolerance * norm_b)
+      break;
+  }
+
+  mv_swap(b, x);
+}
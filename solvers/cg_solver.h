@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////
+/// @file cg_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the CGSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class CGSolver
+/// @brief Preconditioned conjugate gradients on a SparseMatrix. Used as
+///        a SOLVER, factor() keeps the nonzeros of A and sets up a
+///        PRECONDITIONER<T>, so DirichletSolver reuses both across right
+///        hand sides.
+/// @pre A is symmetric positive definite and PRECONDITIONER is derived
+///      from BasePreconditioner and default constructible.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn CGSolver(double tolerance, uint32_t max_iterations)
+/// @brief Constructor.
+/// @pre None.
+/// @post Iteration stops once |r| <= tolerance * |b| or after
+///       max_iterations steps.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b)
+/// @brief Solves Ax = b from x = 0 with any preconditioner set up for A.
+///        A matrix free MATRIX such as StencilOperator3D works too.
+/// @pre gemv(alpha, A, x, beta, y) is defined for MATRIX and b has as
+///      many entries as A has rows. M is set up for A, or null for none.
+/// @post b holds x and iterations() the number of steps taken.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b.
+/// @pre A is symmetric positive definite.
+/// @post iterations() returns the number of steps taken.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/sparse_matrix.h"
+#include "../preconditioners/ic0_preconditioner.h"
+#include "../utilities/blas.h"
+#include "../utilities/trace.h"
+
+template <template <typename> class PRECONDITIONER = IC0Preconditioner>
+class CGSolver
+{
+private:
+  double m_tolerance;
+  uint32_t m_max_iterations;
+  uint32_t m_iterations;
+
+public:
+  template <typename T>
+  struct Factors
+  {
+    SparseMatrix<T> A;
+    PRECONDITIONER<T> M;
+  };
+
+  CGSolver(double tolerance = 1e-10, uint32_t max_iterations = 10000)
+    : m_tolerance(tolerance), m_max_iterations(max_iterations), m_iterations(0) {};
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+  template <typename T, class MATRIX>
+  void solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b);
+
+  uint32_t iterations() const { return m_iterations; }
+};
+
+#include "cg_solver.hpp"
@@ -0,0 +1,85 @@
+#pragma once
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+MathVector<T> CGSolver<PRECONDITIONER>::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void CGSolver<PRECONDITIONER>::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("CGSolver::factor");
+  if(A.getNumRows() != A.getNumColumns())
+    throw domain_error("Matrix must be square: CGSolver.");
+  f.A = SparseMatrix<T>(A);
+  f.M.setup(f.A);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void CGSolver<PRECONDITIONER>::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  solve(f.A, static_cast<const BasePreconditioner<T> *>(&f.M), b);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T, class MATRIX>
+void CGSolver<PRECONDITIONER>::solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b)
+{
+  TraceSpan span("CGSolver::solve");
+  uint32_t n = A.getNumRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: CGSolver.");
+
+  // Copies of b give vectors of the right size to work in
+  MathVector<T> x = b;
+  MathVector<T> r = b;
+  MathVector<T> z = b;
+  MathVector<T> p = b;
+  MathVector<T> q = b;
+  fill(x.data(), x.data() + n, T(0));
+
+  T norm_b = sqrt(r * r);
+  if(M != nullptr)
+    M->apply(r, z);
+  else
+    copy(r.data(), r.data() + n, z.data());
+  p = z;
+  T rz = r * z;
+
+  m_iterations = 0;
+  while(norm_b > T(0) && m_iterations < m_max_iterations)
+  {
+    TraceSpan iteration_span("CGSolver::iteration");
+    gemv(T(1), A, p, T(0), q);
+    T alpha = rz / (p * q);
+    axpy(alpha, p, x);
+    axpy(-alpha, q, r);
+    m_iterations++;
+    if(sqrt(r * r) <= m_tolerance * norm_b)
+      break;
+
+    if(M != nullptr)
+      M->apply(r, z);
+    else
+      copy(r.data(), r.data() + n, z.data());
+    T rz_next = r * z;
+    T beta = rz_next / rz;
+    rz = rz_next;
+    T * ps = p.data();
+    const T * zs = z.data();
+    for(uint32_t i = 0; i < n; i++)
+      ps[i] = zs[i] + beta * ps[i];
+  }
+
+  mv_swap(b, x);
+}
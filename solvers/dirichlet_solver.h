@@ -3,20 +3,38 @@
 #include "../matrices/dense_matrix.h"
 #include "gaussian_solver.h"
 #include "../utilities/qr_decomp.h"
+#include "../utilities/result_writer.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
 
+// SOLVER must provide Factors<T>, factor(A, Factors) and solve(Factors, b)
+// the way GaussianSolver does. The operator A only depends on n, so it is
+// factored once and kept for every later solve with a new right hand side.
+// A configured SOLVER, e.g. SkylineSolver(SkylineSolver::CHOLESKY), can be
+// passed in; solves go through that copy.
 template <typename T, class SOLVER>
 class DirichletSolver
 {
 private:
   int32_t n;
+  bool m_factored;
+  SOLVER m_solver;
+  typename SOLVER::template Factors<T> m_factors;
 
 public:
-  DirichletSolver(int32_t n) : n(n) {};
+  DirichletSolver(int32_t n, SOLVER solver = SOLVER()) : n(n), m_factored(false), m_solver(solver) {};
   MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& B);
+  MathVector<T> operator()(const MathVector<T>& B);
 
   template <long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
   void makeMatrix(DenseMatrix<T>& A, MathVector<T>& B);
-  uint32_t pointIndex(long double i, long double j);
+  void makeOperator(DenseMatrix<T>& A);
+  template <long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
+  void makeVector(MathVector<T>& B);
+  uint32_t pointIndex(int32_t x, int32_t y) const;
+  uint32_t pointIndex(long double i, long double j) const;
+
+  const SOLVER& solver() const { return m_solver; }
 };
 
-#include "dirichlet_solver.hpp"
\ No newline at end of file
+#include "dirichlet_solver.hpp"
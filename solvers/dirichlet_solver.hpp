@@ -8,67 +8,129 @@ MathVector<T> DirichletSolver<T, SOLVER>::operator()(const DenseMatrix<T>& A, co
   return s(A, B);
 }
 
+template <typename T, class SOLVER>
+MathVector<T> DirichletSolver<T, SOLVER>::operator()(const MathVector<T>& B)
+{
+  if(!m_factored)
+  {
+    DenseMatrix<T> A;
+    makeOperator(A);
+    m_solver.factor(A, m_factors);
+    m_factored = true;
+  }
+
+  MathVector<T> x = B;
+  m_solver.solve(m_factors, x);
+  return x;
+}
+
 template <typename T, class SOLVER>
 template <long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
 void DirichletSolver<T, SOLVER>::makeMatrix(DenseMatrix<T>& A, MathVector<T>& B)
 {
-  uint32_t limit = (n - 1) * (n - 1);
-  A = DenseMatrix<T>(limit);
-  B = MathVector<T>(limit);
-  for(uint32_t i = 0; i < B.capacity(); i++)
-    B.push(0);
+  TraceSpan span("DirichletSolver::makeMatrix");
+  makeOperator(A);
+  makeVector<fnXL, fnXU, fnYL, fnYU>(B);
+
+  // The rest only prints B against the expected solution
+  if(!diagnostics_enabled())
+    return;
   MathVector<T> C = B;
   long double diff = 1.0 / n;
-  for(int32_t xIndex = 1; xIndex < n; xIndex++)
+  for(int32_t yIndex = 1; yIndex < n; yIndex++)
   {
-    for(int32_t yIndex = 1; yIndex < n; yIndex++)
+    long double j = diff * yIndex;
+    for(int32_t xIndex = 1; xIndex < n; xIndex++)
     {
       long double i = diff * xIndex;
-      long double j = diff * yIndex;
-
-      // Set 1
-      uint32_t centerIndex = pointIndex(i, j);
-      A(centerIndex, centerIndex, 1);
-      C[centerIndex] = (1 - pow(i, 2)) * (1 + pow(j, 2));
+      C[pointIndex(xIndex, yIndex)] = (1 - i * i) * (1 + j * j);
+    }
+  }
+  cout << B << endl;
+  cout << C << endl << endl;
+  return;
+}
 
-      // For uY
-      long double uY = j + diff;
-      if(yIndex + 1 == n)
-        B[centerIndex] += .25 * fnYU(i);
-      else
-        A(centerIndex, pointIndex(i, uY), -0.25);
+template <typename T, class SOLVER>
+void DirichletSolver<T, SOLVER>::makeOperator(DenseMatrix<T>& A)
+{
+  TraceSpan span("DirichletSolver::makeOperator");
+  uint32_t limit = (n - 1) * (n - 1);
+  A = DenseMatrix<T>(limit);
 
-      // For lY
-      long double lY = j - diff;
-      if(yIndex == 1)
-        B[centerIndex] += .25 * fnYL(i);
-      else
-        A(centerIndex, pointIndex(i, lY), -0.25);
+  // Grid row y only writes the matrix rows of its own points
+  ThreadPool::shared().parallelFor(1, n, 8, [&](uint32_t first, uint32_t last)
+  {
+    for(int32_t yIndex = first; yIndex < int32_t(last); yIndex++)
+    {
+      for(int32_t xIndex = 1; xIndex < n; xIndex++)
+      {
+        uint32_t centerIndex = pointIndex(xIndex, yIndex);
+        T * row = A[centerIndex].data();
+        row[centerIndex] = 1;
 
-      // For uX
-      long double uX = i + diff;
-      if(xIndex + 1 == n)
-        B[centerIndex] += .25 * fnXU(j);
-      else
-        A(centerIndex, pointIndex(uX, j), -0.25);
+        // Neighbours on the boundary go to B instead
+        if(yIndex + 1 != n)
+          row[pointIndex(xIndex, yIndex + 1)] = -0.25;
+        if(yIndex != 1)
+          row[pointIndex(xIndex, yIndex - 1)] = -0.25;
+        if(xIndex + 1 != n)
+          row[pointIndex(xIndex + 1, yIndex)] = -0.25;
+        if(xIndex != 1)
+          row[pointIndex(xIndex - 1, yIndex)] = -0.25;
+      }
+    }
+  });
+  return;
+}
 
-      // For lX
-      long double lX = i - diff;
-      if(xIndex == 1)
-        B[centerIndex] += .25 * fnXL(j);
-      else
-        A(centerIndex, pointIndex(lX, j), -0.25);
+template <typename T, class SOLVER>
+template <long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
+void DirichletSolver<T, SOLVER>::makeVector(MathVector<T>& B)
+{
+  TraceSpan span("DirichletSolver::makeVector");
+  uint32_t limit = (n - 1) * (n - 1);
+  B = MathVector<T>(limit);
+  for(uint32_t i = 0; i < B.capacity(); i++)
+    B.push(0);
 
-    }
+  // Each boundary function is evaluated once per boundary point, in one
+  // pass per side, before anything is added
+  long double diff = 1.0 / n;
+  vector<long double> lowerX(n), upperX(n), lowerY(n), upperY(n);
+  for(int32_t k = 1; k < n; k++)
+  {
+    long double t = diff * k;
+    lowerX[k] = fnXL(t);
+    upperX[k] = fnXU(t);
+    lowerY[k] = fnYL(t);
+    upperY[k] = fnYU(t);
   }
-  cout << B << endl;
-  cout << C << endl << endl;
+
+  // Only points next to the boundary pick anything up. The sides go in
+  // the order the point by point version added them, so corners sum the
+  // same way
+  T * bs = B.data();
+  for(int32_t k = 1; k < n; k++)
+    bs[pointIndex(k, n - 1)] += .25 * upperY[k];
+  for(int32_t k = 1; k < n; k++)
+    bs[pointIndex(k, 1)] += .25 * lowerY[k];
+  for(int32_t k = 1; k < n; k++)
+    bs[pointIndex(n - 1, k)] += .25 * upperX[k];
+  for(int32_t k = 1; k < n; k++)
+    bs[pointIndex(1, k)] += .25 * lowerX[k];
   return;
 }
 
 template <typename T, class SOLVER>
-uint32_t DirichletSolver<T, SOLVER>::pointIndex(long double i, long double j)
+uint32_t DirichletSolver<T, SOLVER>::pointIndex(int32_t x, int32_t y) const
 {
-  long double diff = 1.0 / n;
-  return (n - 1) * ((j/diff) - 1) + ((i/diff) - 1);
-}
\ No newline at end of file
+  return (n - 1) * (y - 1) + (x - 1);
+}
+
+template <typename T, class SOLVER>
+uint32_t DirichletSolver<T, SOLVER>::pointIndex(long double i, long double j) const
+{
+  // Rounded to the nearest grid point, since i * n need not come out whole
+  return pointIndex(int32_t(lroundl(i * n)), int32_t(lroundl(j * n)));
+}
@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////////////////////////
+/// @file dirichlet_solver_3d.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the DirichletSolver3D class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class DirichletSolver3D
+/// @brief Laplace's equation on the unit cube with spacing 1 / n and
+///        the values on the six faces given by functions of the two
+///        coordinates along the face. The 7-point operator is kept as a
+///        StencilOperator3D and never assembled, so SOLVER only sees it
+///        through gemv and the (n - 1)^3 unknowns cost a few vectors of
+///        memory.
+/// @pre SOLVER provides solve(A, M, b) for any MATRIX with gemv and a
+///      null preconditioner M, as CGSolver and GMRESSolver do.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn DirichletSolver3D(int32_t n, SOLVER solver)
+/// @brief Constructor.
+/// @pre n > 1.
+/// @post Solves go through a copy of solver.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void makeOperator(StencilOperator3D<T>& A)
+/// @brief Sets A to the operator: 1 on the diagonal and -1/6 at each
+///        neighbour inside the cube.
+/// @pre None.
+/// @post A is (n - 1)^3 x (n - 1)^3.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void makeVector<fnXL, fnXU, fnYL, fnYU, fnZL, fnZU>(MathVector<T>& B)
+/// @brief Sets B to 1/6 of the face values next to each point. fnXL and
+///        fnXU are the faces x = 0 and x = 1 taking (y, z), fnY* take
+///        (x, z) and fnZ* take (x, y).
+/// @pre None.
+/// @post B has (n - 1)^3 entries numbered as pointIndex() does.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn uint32_t pointIndex(int32_t x, int32_t y, int32_t z)
+/// @brief Unknown of interior point (x / n, y / n, z / n), x fastest.
+/// @pre 0 < x, y, z < n.
+/// @return Returns the index.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const MathVector<T>& B)
+/// @fn MathVector<T> operator ()<fnXL, fnXU, fnYL, fnYU, fnZL, fnZU>()
+/// @brief Solves with right hand side B, or builds it from the face
+///        functions first.
+/// @pre B came from makeVector().
+/// @post solver() holds what the solve left, e.g. iterations().
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "../matrices/stencil_operator.h"
+#include "../interfaces/base_preconditioner.h"
+#include "cg_solver.h"
+#include "../utilities/trace.h"
+
+template <typename T, class SOLVER = CGSolver<>>
+class DirichletSolver3D
+{
+private:
+  int32_t n;
+  SOLVER m_solver;
+
+public:
+  DirichletSolver3D(int32_t n, SOLVER solver = SOLVER()) : n(n), m_solver(solver) {};
+  MathVector<T> operator()(const MathVector<T>& B);
+  template <long double fnXL (long double, long double), long double fnXU (long double, long double),
+            long double fnYL (long double, long double), long double fnYU (long double, long double),
+            long double fnZL (long double, long double), long double fnZU (long double, long double)>
+  MathVector<T> operator()();
+
+  void makeOperator(StencilOperator3D<T>& A);
+  template <long double fnXL (long double, long double), long double fnXU (long double, long double),
+            long double fnYL (long double, long double), long double fnYU (long double, long double),
+            long double fnZL (long double, long double), long double fnZU (long double, long double)>
+  void makeVector(MathVector<T>& B);
+  uint32_t pointIndex(int32_t x, int32_t y, int32_t z) const;
+
+  const SOLVER& solver() const { return m_solver; }
+};
+
+#include "dirichlet_solver_3d.hpp"
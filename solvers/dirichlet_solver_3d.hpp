@@ -0,0 +1,74 @@
+#pragma once
+
+template <typename T, class SOLVER>
+MathVector<T> DirichletSolver3D<T, SOLVER>::operator()(const MathVector<T>& B)
+{
+  StencilOperator3D<T> A;
+  MathVector<T> x = B;
+
+  makeOperator(A);
+  m_solver.solve(A, static_cast<const BasePreconditioner<T> *>(nullptr), x);
+
+  return x;
+}
+
+template <typename T, class SOLVER>
+template <long double fnXL (long double, long double), long double fnXU (long double, long double),
+          long double fnYL (long double, long double), long double fnYU (long double, long double),
+          long double fnZL (long double, long double), long double fnZU (long double, long double)>
+MathVector<T> DirichletSolver3D<T, SOLVER>::operator()()
+{
+  MathVector<T> B;
+  makeVector<fnXL, fnXU, fnYL, fnYU, fnZL, fnZU>(B);
+  return (*this)(B);
+}
+
+template <typename T, class SOLVER>
+void DirichletSolver3D<T, SOLVER>::makeOperator(StencilOperator3D<T>& A)
+{
+  if(n < 2)
+    throw domain_error("Grid must have interior points: DirichletSolver3D.");
+  uint32_t side = n - 1;
+  A = StencilOperator3D<T>(side, side, side, T(1), T(-1) / 6, T(-1) / 6, T(-1) / 6);
+}
+
+template <typename T, class SOLVER>
+template <long double fnXL (long double, long double), long double fnXU (long double, long double),
+          long double fnYL (long double, long double), long double fnYU (long double, long double),
+          long double fnZL (long double, long double), long double fnZU (long double, long double)>
+void DirichletSolver3D<T, SOLVER>::makeVector(MathVector<T>& B)
+{
+  TraceSpan span("DirichletSolver3D::makeVector");
+  if(n < 2)
+    throw domain_error("Grid must have interior points: DirichletSolver3D.");
+  uint32_t side = n - 1;
+  B = MathVector<T>(side * side * side);
+  for(uint32_t i = 0; i < B.capacity(); i++)
+    B.push(0);
+
+  // Only points next to a face pick anything up, a face of points at a
+  // time; the edges and corners are reached from each of their faces
+  long double diff = 1.0 / n;
+  T * bs = B.data();
+  for(int32_t a = 1; a < n; a++)
+  {
+    for(int32_t b = 1; b < n; b++)
+    {
+      long double u = diff * a;
+      long double v = diff * b;
+      bs[pointIndex(1, a, b)] += fnXL(u, v) / 6;
+      bs[pointIndex(n - 1, a, b)] += fnXU(u, v) / 6;
+      bs[pointIndex(a, 1, b)] += fnYL(u, v) / 6;
+      bs[pointIndex(a, n - 1, b)] += fnYU(u, v) / 6;
+      bs[pointIndex(a, b, 1)] += fnZL(u, v) / 6;
+      bs[pointIndex(a, b, n - 1)] += fnZU(u, v) / 6;
+    }
+  }
+}
+
+template <typename T, class SOLVER>
+uint32_t DirichletSolver3D<T, SOLVER>::pointIndex(int32_t x, int32_t y, int32_t z) const
+{
+  uint32_t side = n - 1;
+  return ((z - 1) * side + (y - 1)) * side + (x - 1);
+}
@@ -0,0 +1,109 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fast_poisson_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the FastPoissonSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class FastPoissonSolver
+/// @brief Direct solver for constant coefficient 5-point operators on
+///        a square grid, such as the one DirichletSolver::makeOperator
+///        builds. The discrete sine transform diagonalizes them, so a
+///        solve is a 2D DST-I, a division by the known eigenvalues and
+///        another 2D DST-I: O(N log N) time and O(N) memory.
+/// @pre The matrix has one unknown per point of a square grid, numbered
+///      row by row as DirichletSolver::pointIndex does, and the same
+///      stencil at every point.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const DenseMatrix<T>& A, Factors<T>& f)
+/// @brief Reads the stencil off A, checks every row against it and
+///        builds the transform plan.
+/// @pre A is (m*m) x (m*m) for some m.
+/// @post f can be passed to solve() any number of times.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(uint32_t side, T diagonal, T coupling_x, T coupling_y, Factors<T>& f)
+/// @brief Same as above from the stencil itself, without a matrix.
+/// @pre side > 0.
+/// @post f can be passed to solve() any number of times.
+/// @param1 Interior points per side of the grid.
+/// @param2 Coefficient of the point itself.
+/// @param3 Coefficient of its left and right neighbours.
+/// @param4 Coefficient of its lower and upper neighbours.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const Factors<T>& f, MathVector<T>& b)
+/// @brief Solves with the stored stencil.
+/// @pre f came from factor() and b has side * side entries.
+/// @post b holds x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b.
+/// @pre Same as factor().
+/// @post None.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> solveGrid(int32_t n)
+/// @brief Solves the Dirichlet problem with spacing 1 / n for the
+///        boundary functions DirichletSolver takes, building only the
+///        right hand side and never the (n-1)^2 x (n-1)^2 matrix.
+/// @pre n > 1.
+/// @post None.
+/// @return Returns x, numbered as DirichletSolver::pointIndex does.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../utilities/fft.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
+
+class FastPoissonSolver
+{
+public:
+  template <typename T>
+  struct Factors
+  {
+    uint32_t side;
+    T diagonal;
+    T coupling_x;
+    T coupling_y;
+    // cos(k pi / (side + 1)) for k = 1 .. side
+    vector<T> cosines;
+    // Length 2 (side + 1), the odd extension each DST-I goes through
+    FFT<T> plan;
+  };
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void factor(uint32_t side, T diagonal, T coupling_x, T coupling_y, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+
+  template <typename T, long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
+  MathVector<T> solveGrid(int32_t n);
+
+private:
+  // Orthonormal DST-I of every grid row (along_x) or column in place
+  template <typename T>
+  void sine(const Factors<T>& f, T * data, bool along_x) const;
+};
+
+#include "fast_poisson_solver.hpp"
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "dirichlet_solver.h"
+
+template <typename T>
+MathVector<T> FastPoissonSolver::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <typename T>
+void FastPoissonSolver::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("FastPoissonSolver::factor");
+  uint32_t n = A.getNumRows();
+  uint32_t side = static_cast<uint32_t>(round(sqrt(static_cast<double>(n))));
+  if(side * side != n || A.getNumColumns() != n)
+    throw domain_error("Matrix is not a square grid operator: FastPoissonSolver.");
+
+  T diagonal = A[0].data()[0];
+  T coupling_x = side > 1 ? A[0].data()[1] : T(0);
+  T coupling_y = side > 1 ? A[0].data()[side] : T(0);
+  for(uint32_t p = 0; p < n; p++)
+  {
+    const T * row = A[p].data();
+    uint32_t x = p % side;
+    uint32_t y = p / side;
+    for(uint32_t q = 0; q < n; q++)
+    {
+      T expected = 0;
+      if(q == p)
+        expected = diagonal;
+      else if((x > 0 && q == p - 1) || (x + 1 < side && q == p + 1))
+        expected = coupling_x;
+      else if((y > 0 && q == p - side) || (y + 1 < side && q == p + side))
+        expected = coupling_y;
+      if(row[q] != expected)
+        throw domain_error("Matrix is not a constant 5-point stencil: FastPoissonSolver.");
+    }
+  }
+
+  factor(side, diagonal, coupling_x, coupling_y, f);
+}
+
+template <typename T>
+void FastPoissonSolver::factor(uint32_t side, T diagonal, T coupling_x, T coupling_y, Factors<T>& f)
+{
+  if(side == 0)
+    throw domain_error("Grid must have interior points: FastPoissonSolver.");
+  f.side = side;
+  f.diagonal = diagonal;
+  f.coupling_x = coupling_x;
+  f.coupling_y = coupling_y;
+
+  // The 1D second difference with m points has eigenvectors
+  // sin(jk pi / (m + 1)) and the stencil eigenvalues follow from them
+  f.cosines.resize(side);
+  for(uint32_t k = 0; k < side; k++)
+    f.cosines[k] = T(cos(M_PI * (k + 1) / (side + 1)));
+  for(uint32_t kx = 0; kx < side; kx++)
+    for(uint32_t ky = 0; ky < side; ky++)
+      if(diagonal + 2 * coupling_x * f.cosines[kx] + 2 * coupling_y * f.cosines[ky] == T(0))
+        throw domain_error("Matrix is singular: FastPoissonSolver.");
+
+  if(f.plan.length() != 2 * (side + 1))
+    f.plan = FFT<T>(2 * (side + 1));
+}
+
+template <typename T>
+void FastPoissonSolver::sine(const Factors<T>& f, T * data, bool along_x) const
+{
+  const uint32_t LANES = 32;
+  uint32_t m = f.side;
+  uint32_t length = 2 * (m + 1);
+  T scale = T(-0.5 * sqrt(2.0 / (m + 1)));
+
+  // Entry j of sequence s; sequences are rows along x, columns along y
+  auto index = [m, along_x](uint32_t j, uint32_t s) { return along_x ? s * m + j : j * m + s; };
+
+  ThreadPool::shared().parallelFor(0, m, LANES, [&](uint32_t first, uint32_t last)
+  {
+    uint32_t lanes = last - first;
+    vector<T> re(length * lanes, T(0));
+    vector<T> im(length * lanes, T(0));
+
+    // Odd extension 0, x_1 .. x_m, 0, -x_m .. -x_1, whose transform is
+    // -2i times the sine sums
+    for(uint32_t j = 0; j < m; j++)
+      for(uint32_t s = 0; s < lanes; s++)
+      {
+        T v = data[index(j, first + s)];
+        re[(j + 1) * lanes + s] = v;
+        re[(length - 1 - j) * lanes + s] = -v;
+      }
+    f.plan.transform(re.data(), im.data(), lanes, false);
+    for(uint32_t k = 0; k < m; k++)
+      for(uint32_t s = 0; s < lanes; s++)
+        data[index(k, first + s)] = scale * im[(k + 1) * lanes + s];
+  });
+}
+
+template <typename T>
+void FastPoissonSolver::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  TraceSpan span("FastPoissonSolver::solve");
+  uint32_t m = f.side;
+  if(b.size() != m * m)
+    throw domain_error("Vector size not compatible: FastPoissonSolver.");
+  T * x = b.data();
+
+  // The orthonormal DST-I is its own inverse, so x = S D^-1 S b
+  sine(f, x, true);
+  sine(f, x, false);
+  for(uint32_t ky = 0; ky < m; ky++)
+  {
+    T partial = f.diagonal + 2 * f.coupling_y * f.cosines[ky];
+    T * row = x + ky * m;
+    for(uint32_t kx = 0; kx < m; kx++)
+      row[kx] /= partial + 2 * f.coupling_x * f.cosines[kx];
+  }
+  sine(f, x, false);
+  sine(f, x, true);
+}
+
+template <typename T, long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
+MathVector<T> FastPoissonSolver::solveGrid(int32_t n)
+{
+  TraceSpan span("FastPoissonSolver::solveGrid");
+  if(n < 2)
+    throw domain_error("Grid must have interior points: FastPoissonSolver.");
+  DirichletSolver<T, FastPoissonSolver> dirichlet(n);
+  MathVector<T> x;
+  Factors<T> f;
+
+  // Same stencil DirichletSolver::makeOperator assembles
+  dirichlet.template makeVector<fnXL, fnXU, fnYL, fnYU>(x);
+  factor(uint32_t(n - 1), T(1), T(-0.25), T(-0.25), f);
+  solve(f, x);
+
+  return x;
+}
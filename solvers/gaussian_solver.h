@@ -1,12 +1,48 @@
 #pragma once
 
+#include <vector>
 #include "../matrices/dense_matrix.h"
+#include "../matrices/fixed_matrix.h"
+#include "../utilities/trace.h"
+#include "../utilities/trsm.h"
 
 class GaussianSolver
 {
 public:
+  // LU factors of a square matrix. Multipliers of L are kept below the
+  // diagonal of LU, U on and above it. pivots[j] is the row swapped with j.
+  template <typename T>
+  struct Factors
+  {
+    DenseMatrix<T> LU;
+    vector<uint32_t> pivots;
+  };
+
 	template <typename T>
   MathVector<T> operator()(const DenseMatrix<T>& m, const MathVector<T>& s);
+  // Solves for every column of B (n x k) with a single factorization
+  template <typename T>
+  DenseMatrix<T> operator()(const DenseMatrix<T>& m, const DenseMatrix<T>& B);
+  // Fully unrolled elimination for sizes known at compile time
+  template <typename T, uint32_t N>
+  FixedVector<T, N> operator()(const FixedMatrix<T, N, N>& m, const FixedVector<T, N>& s) const;
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& m, Factors<T>& f) const;
+  // Overwrite mode: m's storage becomes f.LU instead of being copied
+  template <typename T>
+  void factor(DenseMatrix<T>&& m, Factors<T>& f) const;
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b) const;
+  template <typename T>
+  void solve(const Factors<T>& f, DenseMatrix<T>& B) const;
+  // Overwrite mode: A ends up holding its LU factors and b the solution
+  template <typename T>
+  void solveInPlace(DenseMatrix<T>& A, MathVector<T>& b) const;
+
+private:
+  template <typename T>
+  void eliminate(Factors<T>& f) const;
 };
 
 #include "gaussian_solver.hpp"
@@ -1,39 +1,181 @@
 #pragma once
 
+#include <cmath>
+
 template<typename T>
 MathVector<T> GaussianSolver::operator()(const DenseMatrix<T>& m, const MathVector<T>& s)
 {
+  Factors<T> f;
   MathVector<T> b = s;
-  DenseMatrix<T> A(m.clone());
-  uint32_t n = A.getNumRows();
-  // To generate the upper triangular matrix
-  long double sum = 0;
 
-  for(uint32_t j = 0; j < n; j++)
+  factor(m, f);
+  solve(f, b);
+
+  return b;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver::operator()(const DenseMatrix<T>& m, const DenseMatrix<T>& B)
+{
+  Factors<T> f;
+  DenseMatrix<T> X(B);
+
+  factor(m, f);
+  solve(f, X);
+
+  return X;
+}
+
+template <typename T, uint32_t N>
+FixedVector<T, N> GaussianSolver::operator()(const FixedMatrix<T, N, N>& m, const FixedVector<T, N>& s) const
+{
+  FixedMatrix<T, N, N> A = m;
+  FixedVector<T, N> b = s;
+
+  unroll<0, N>([&](auto j)
+  {
+    constexpr uint32_t J = decltype(j)::value;
+
+    // Partial pivoting, only swapping when a row is strictly larger
+    uint32_t p = J;
+    unroll<J + 1, N>([&](auto i)
+    {
+      if(fabs(A(i, J)) > fabs(A(p, J)))
+        p = i;
+    });
+    if(p != J)
+    {
+      unroll<J, N>([&](auto k) { swap(A.at(J, k), A.at(p, k)); });
+      swap(b[J], b[p]);
+    }
+
+    unroll<J + 1, N>([&](auto i)
+    {
+      T c = A(i, J) / A(J, J);
+      unroll<J + 1, N>([&](auto k) { A.at(i, k) -= c * A(J, k); });
+      b[i] -= c * b[J];
+    });
+  });
+
+  unroll<0, N>([&](auto r)
+  {
+    constexpr uint32_t I = N - 1 - decltype(r)::value;
+    T sum = 0;
+    unroll<I + 1, N>([&](auto j) { sum += A(I, j) * b[j]; });
+    b[I] = (b[I] - sum) / A(I, I);
+  });
+
+  return b;
+}
+
+template <typename T>
+void GaussianSolver::factor(const DenseMatrix<T>& m, Factors<T>& f) const
+{
+  uint32_t n = m.getNumRows();
+
+  // Reuse the storage from an earlier factorization of the same size
+  if(f.LU.getNumRows() == n && f.LU.getNumColumns() == m.getNumColumns())
     for(uint32_t i = 0; i < n; i++)
-      if(i > j)
-      {
-        long double c = A(i, j) / A(j, j);
-        for(uint32_t k = 0; k < n + 1; k++)
-          if(k == n)
-          {
-            b[i] = b[i] - c*b[j];
-          } 
-          else
-          {
-            A(i, k, A(i, k) - c*A(j, k));
-          }
-      }
-  b[n-1] = b[n-1] / A(n-1, n-1);
-  for(int32_t i = n - 2; i >= 0; i--)
+      copy(m[i].data(), m[i].data() + m.getNumColumns(), f.LU[i].data());
+  else
+    f.LU = m;
+  eliminate(f);
+}
+
+template <typename T>
+void GaussianSolver::factor(DenseMatrix<T>&& m, Factors<T>& f) const
+{
+  f.LU = move(m);
+  eliminate(f);
+}
+
+template <typename T>
+void GaussianSolver::solveInPlace(DenseMatrix<T>& A, MathVector<T>& b) const
+{
+  Factors<T> f;
+
+  factor(move(A), f);
+  solve(f, b);
+  A = move(f.LU);
+}
+
+template <typename T>
+void GaussianSolver::eliminate(Factors<T>& f) const
+{
+  TraceSpan span("GaussianSolver::eliminate");
+  uint32_t n = f.LU.getNumRows();
+  f.pivots.assign(n, 0);
+
+  for(uint32_t j = 0; j < n; j++)
   {
+    // Partial pivoting, only swapping when a row is strictly larger
+    uint32_t p = j;
+    for(uint32_t i = j + 1; i < n; i++)
+      if(fabs(f.LU(i, j)) > fabs(f.LU(p, j)))
+        p = i;
+    f.pivots[j] = p;
+    if(p != j)
+      mv_swap(f.LU[p], f.LU[j]);
+
+    T * pivot_row = f.LU[j].data();
+    if(!(fabs(pivot_row[j]) > 0) || !isfinite(pivot_row[j]))
+      throw domain_error("Zero or non-finite pivot: GaussianSolver.");
+    for(uint32_t i = j + 1; i < n; i++)
+    {
+      T * row = f.LU[i].data();
+      T c = row[j] / pivot_row[j];
+      row[j] = c;
+      for(uint32_t k = j + 1; k < n; k++)
+        row[k] -= c * pivot_row[k];
+    }
+  }
+}
+
+template <typename T>
+void GaussianSolver::solve(const Factors<T>& f, MathVector<T>& b) const
+{
+  TraceSpan span("GaussianSolver::backSubstitute");
+  uint32_t n = f.LU.getNumRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: GaussianSolver.");
+  T * x = b.data();
+  T sum = 0;
+
+  // Apply the row swaps and L to b
+  for(uint32_t j = 0; j < n; j++)
+    if(f.pivots[j] != j)
+      swap(x[j], x[f.pivots[j]]);
+  for(uint32_t i = 1; i < n; i++)
+  {
+    const T * row = f.LU[i].data();
+    for(uint32_t j = 0; j < i; j++)
+      x[i] = x[i] - row[j] * x[j];
+  }
+
+  // Back substitute through U
+  for(int32_t i = n - 1; i >= 0; i--)
+  {
+    const T * row = f.LU[i].data();
     sum = 0;
     for(uint32_t j = i + 1; j < n; j++)
     {
-      sum += A(i, j) * b[j];
+      sum += row[j] * x[j];
     }
-    b[i] = (b[i] - sum)/A(i, i);
+    x[i] = (x[i] - sum) / row[i];
   }
+}
 
-  return b;
-}
\ No newline at end of file
+template <typename T>
+void GaussianSolver::solve(const Factors<T>& f, DenseMatrix<T>& B) const
+{
+  TraceSpan span("GaussianSolver::backSubstitute");
+  const DenseMatrix<T>& LU = f.LU;
+  if(B.getNumRows() != LU.getNumRows())
+    throw domain_error("Matrix sizes not compatible: GaussianSolver.");
+
+  for(uint32_t j = 0; j < B.getNumRows(); j++)
+    if(f.pivots[j] != j)
+      mv_swap(B[j], B[f.pivots[j]]);
+  trsm_lower_unit(LU, B);
+  trsm_upper(LU, B);
+}
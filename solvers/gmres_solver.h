@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////
+/// @file gmres_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the GMRESSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class GMRESSolver
+/// @brief Restarted GMRES(m) for nonsymmetric systems. The Arnoldi basis
+///        is built with modified Gram-Schmidt and the least squares
+///        problem is kept triangular with Givens rotations, so the
+///        residual norm is known every step without forming x. Right
+///        preconditioning keeps that norm the true residual.
+/// @pre PRECONDITIONER is derived from BasePreconditioner and default
+///      constructible.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn GMRESSolver(uint32_t restart, double tolerance, uint32_t max_iterations)
+/// @brief Constructor.
+/// @pre restart > 0.
+/// @post The basis holds at most restart vectors, iteration stops once
+///       |r| <= tolerance * |b| or after max_iterations Arnoldi steps.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const MATRIX& A, const MathVector<T>& b)
+/// @brief Solves Ax = b. DenseMatrix and SparseMatrix are preconditioned
+///        with PRECONDITIONER, any other MATRIX is used unpreconditioned.
+/// @pre gemv(alpha, A, x, beta, y) is defined for MATRIX.
+/// @post iterations() returns the number of Arnoldi steps taken.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b)
+/// @brief Solves Ax = b from x = 0.
+/// @pre gemv is defined for MATRIX. M is set up for A, or null for none.
+/// @post b holds x and iterations() the number of Arnoldi steps taken.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/sparse_matrix.h"
+#include "../preconditioners/ilu0_preconditioner.h"
+#include "../utilities/blas.h"
+#include "../utilities/trace.h"
+
+template <template <typename> class PRECONDITIONER = ILU0Preconditioner>
+class GMRESSolver
+{
+private:
+  uint32_t m_restart;
+  double m_tolerance;
+  uint32_t m_max_iterations;
+  uint32_t m_iterations;
+
+public:
+  template <typename T>
+  struct Factors
+  {
+    SparseMatrix<T> A;
+    PRECONDITIONER<T> M;
+  };
+
+  GMRESSolver(uint32_t restart = 30, double tolerance = 1e-10, uint32_t max_iterations = 10000)
+    : m_restart(restart), m_tolerance(tolerance), m_max_iterations(max_iterations), m_iterations(0) {};
+
+  template <typename T, class MATRIX>
+  MathVector<T> operator()(const MATRIX& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void factor(const SparseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+  template <typename T, class MATRIX>
+  void solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b);
+
+  uint32_t iterations() const { return m_iterations; }
+};
+
+#include "gmres_solver.hpp"
@@ -0,0 +1,157 @@
+#pragma once
+
+template <template <typename> class PRECONDITIONER>
+template <typename T, class MATRIX>
+MathVector<T> GMRESSolver<PRECONDITIONER>::operator()(const MATRIX& A, const MathVector<T>& b)
+{
+  MathVector<T> x = b;
+
+  if constexpr(is_same<MATRIX, DenseMatrix<T>>::value || is_same<MATRIX, SparseMatrix<T>>::value)
+  {
+    Factors<T> f;
+    factor(A, f);
+    solve(f, x);
+  }
+  else
+    solve(A, static_cast<const BasePreconditioner<T> *>(nullptr), x);
+
+  return x;
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void GMRESSolver<PRECONDITIONER>::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  factor(SparseMatrix<T>(A), f);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void GMRESSolver<PRECONDITIONER>::factor(const SparseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("GMRESSolver::factor");
+  if(A.getNumRows() != A.getNumColumns())
+    throw domain_error("Matrix must be square: GMRESSolver.");
+  f.A = A;
+  f.M.setup(f.A);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T>
+void GMRESSolver<PRECONDITIONER>::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  solve(f.A, static_cast<const BasePreconditioner<T> *>(&f.M), b);
+}
+
+template <template <typename> class PRECONDITIONER>
+template <typename T, class MATRIX>
+void GMRESSolver<PRECONDITIONER>::solve(const MATRIX& A, const BasePreconditioner<T> * M, MathVector<T>& b)
+{
+  TraceSpan span("GMRESSolver::solve");
+  uint32_t n = A.getNumRows();
+  uint32_t m = m_restart;
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: GMRESSolver.");
+  if(m == 0)
+    throw domain_error("Restart length must be positive: GMRESSolver.");
+
+  // Everything the restarts need is allocated here once; copies of b
+  // are just vectors of the right size
+  vector<MathVector<T>> V(m + 1, b);
+  vector<T> H((m + 1) * m);
+  vector<T> cs(m);
+  vector<T> sn(m);
+  vector<T> g(m + 1);
+  vector<T> y(m);
+  MathVector<T> x = b;
+  MathVector<T> w = b;
+  MathVector<T> z = b;
+  fill(x.data(), x.data() + n, T(0));
+  auto h = [&](uint32_t i, uint32_t j) -> T& { return H[i * m + j]; };
+
+  T norm_b = sqrt(b * b);
+  m_iterations = 0;
+  while(norm_b > T(0) && m_iterations < m_max_iterations)
+  {
+    // r = b - Ax starts the basis
+    gemv(T(1), A, x, T(0), w);
+    T * v0 = V[0].data();
+    for(uint32_t i = 0; i < n; i++)
+      v0[i] = b.data()[i] - w.data()[i];
+    T beta = sqrt(V[0] * V[0]);
+    if(beta <= m_tolerance * norm_b)
+      break;
+    scal(T(1) / beta, V[0]);
+    fill(g.begin(), g.end(), T(0));
+    g[0] = beta;
+
+    uint32_t k = 0;
+    while(k < m && m_iterations < m_max_iterations)
+    {
+      TraceSpan iteration_span("GMRESSolver::iteration");
+      if(M != nullptr)
+      {
+        M->apply(V[k], z);
+        gemv(T(1), A, z, T(0), w);
+      }
+      else
+        gemv(T(1), A, V[k], T(0), w);
+
+      // Modified Gram-Schmidt against the basis so far
+      for(uint32_t i = 0; i <= k; i++)
+      {
+        h(i, k) = w * V[i];
+        axpy(-h(i, k), V[i], w);
+      }
+      h(k + 1, k) = sqrt(w * w);
+
+      // Earlier rotations, then a new one zeroing h(k+1, k)
+      for(uint32_t i = 0; i < k; i++)
+      {
+        T upper = cs[i] * h(i, k) + sn[i] * h(i + 1, k);
+        h(i + 1, k) = -sn[i] * h(i, k) + cs[i] * h(i + 1, k);
+        h(i, k) = upper;
+      }
+      T radius = hypot(h(k, k), h(k + 1, k));
+      T next = h(k + 1, k);
+      cs[k] = radius == T(0) ? T(1) : h(k, k) / radius;
+      sn[k] = radius == T(0) ? T(0) : next / radius;
+      h(k, k) = radius;
+      h(k + 1, k) = 0;
+      g[k + 1] = -sn[k] * g[k];
+      g[k] = cs[k] * g[k];
+
+      k++;
+      m_iterations++;
+      // Small residual, or w vanished and the basis spans the solution
+      if(fabs(g[k]) <= m_tolerance * norm_b || next == T(0))
+        break;
+      mv_swap(V[k], w);
+      scal(T(1) / next, V[k]);
+    }
+
+    // x += M^-1 V y with y from the triangular system
+    for(int32_t i = k - 1; i >= 0; i--)
+    {
+      T sum = g[i];
+      for(uint32_t j = i + 1; j < k; j++)
+        sum -= h(i, j) * y[j];
+      y[i] = sum / h(i, i);
+    }
+    fill(w.data(), w.data() + n, T(0));
+    for(uint32_t i = 0; i < k; i++)
+      axpy(y[i], V[i], w);
+    if(M != nullptr)
+    {
+      M->apply(w, z);
+      axpy(T(1), z, x);
+    }
+    else
+      axpy(T(1), w, x);
+
+    if(fabs(g[k]) <= m_tolerance * norm_b)
+      break;
+  }
+
+  mv_swap(b, x);
+}
@@ -1,14 +1,43 @@
 #pragma once
 
 #include "../matrices/dense_matrix.h"
+#include "../matrices/upper_tri_matrix.h"
 #include "../utilities/qr_decomp.h"
 #include "gaussian_solver.h"
+#include "../utilities/trsm.h"
 
 class QRSolver
 {
 public:
+  // R and the transpose of Q, the form the solve applies Q in
+  template <typename T>
+  struct Factors
+  {
+    DenseMatrix<T> Qt;
+    UpperTriMatrix<T> R;
+  };
+
   template <typename T>
   MathVector<T> operator()(const DenseMatrix<T>& m, const MathVector<T>& s);
+  // Solves for every column of B (n x k) with a single factorization
+  template <typename T>
+  DenseMatrix<T> operator()(const DenseMatrix<T>& m, const DenseMatrix<T>& B);
+  // Fully unrolled QR solve for sizes known at compile time
+  template <typename T, uint32_t N>
+  FixedVector<T, N> operator()(const FixedMatrix<T, N, N>& m, const FixedVector<T, N>& s) const;
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& m, Factors<T>& f) const;
+  // Overwrite mode: m's storage becomes f.Qt instead of being copied
+  template <typename T>
+  void factor(DenseMatrix<T>&& m, Factors<T>& f) const;
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b) const;
+  template <typename T>
+  void solve(const Factors<T>& f, DenseMatrix<T>& B) const;
+  // Overwrite mode: A ends up holding Qt and b the solution
+  template <typename T>
+  void solveInPlace(DenseMatrix<T>& A, MathVector<T>& b) const;
 };
 
-#include "qr_solver.hpp"
\ No newline at end of file
+#include "qr_solver.hpp"
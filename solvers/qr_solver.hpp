@@ -3,14 +3,115 @@
 template <typename T>
 MathVector<T> QRSolver::operator()(const DenseMatrix<T>& m, const MathVector<T>& s)
 {
-  DenseMatrix<T> Q, Qt, A;
-  UpperTriMatrix<T> R;
+  Factors<T> f;
+  MathVector<T> b = s;
+
+  factor(m, f);
+  solve(f, b);
+
+  return b;
+}
+
+template <typename T>
+DenseMatrix<T> QRSolver::operator()(const DenseMatrix<T>& m, const DenseMatrix<T>& B)
+{
+  Factors<T> f;
+  DenseMatrix<T> X(B);
+
+  factor(m, f);
+  solve(f, X);
+
+  return X;
+}
+
+template <typename T, uint32_t N>
+FixedVector<T, N> QRSolver::operator()(const FixedMatrix<T, N, N>& m, const FixedVector<T, N>& s) const
+{
+  FixedMatrix<T, N, N> Q, R;
   QRDecomp qr;
   qr(m, Q, R);
-  Qt = DenseMatrix<T>(Q.transpose());
 
-  MathVector<T> b = Qt * s;
-  A = DenseMatrix<T>(R.clone());
-  GaussianSolver gs;
-  return gs(A, b);
-}
\ No newline at end of file
+  // Qt * s read down the columns of Q, then back substitute through R
+  FixedVector<T, N> y;
+  unroll<0, N>([&](auto i)
+  {
+    T sum = 0;
+    unroll<0, N>([&](auto j) { sum += Q(j, i) * s[j]; });
+    y[i] = sum;
+  });
+  unroll<0, N>([&](auto r)
+  {
+    constexpr uint32_t I = N - 1 - decltype(r)::value;
+    T sum = 0;
+    unroll<I + 1, N>([&](auto j) { sum += R(I, j) * y[j]; });
+    y[I] = (y[I] - sum) / R(I, I);
+  });
+
+  return y;
+}
+
+template <typename T>
+void QRSolver::factor(const DenseMatrix<T>& m, Factors<T>& f) const
+{
+  QRDecomp qr;
+  qr.factorTransposed(m, f.Qt, f.R);
+}
+
+template <typename T>
+void QRSolver::factor(DenseMatrix<T>&& m, Factors<T>& f) const
+{
+  QRDecomp qr;
+  f.Qt = move(m);
+  qr.factorInPlace(f.Qt, f.R);
+}
+
+template <typename T>
+void QRSolver::solve(const Factors<T>& f, MathVector<T>& b) const
+{
+  TraceSpan span("QRSolver::solve");
+  uint32_t n = f.Qt.getNumRows();
+  MathVector<T> y(n);
+  T sum = 0;
+
+  // y = Qt * b
+  for(uint32_t i = 0; i < n; i++)
+    y.push(0);
+  gemv(T(1), f.Qt, b, T(0), y);
+
+  // Back substitute through R
+  for(int32_t i = n - 1; i >= 0; i--)
+  {
+    // Row i of R is stored from column i on
+    const T * r = f.R[i].data();
+    sum = 0;
+    for(uint32_t j = i + 1; j < n; j++)
+      sum += r[j - i] * y.data()[j];
+    y.data()[i] = (y.data()[i] - sum) / r[0];
+  }
+
+  mv_swap(b, y);
+}
+
+template <typename T>
+void QRSolver::solve(const Factors<T>& f, DenseMatrix<T>& B) const
+{
+  TraceSpan span("QRSolver::solve");
+  uint32_t n = f.Qt.getNumRows();
+  if(B.getNumRows() != n)
+    throw domain_error("Matrix sizes not compatible: QRSolver.");
+  DenseMatrix<T> Y(n, B.getNumColumns());
+
+  gemm(T(1), f.Qt, B, T(0), Y);
+  trsm_upper(f.R, Y);
+  bm_swap(B, Y);
+}
+
+template <typename T>
+void QRSolver::solveInPlace(DenseMatrix<T>& A, MathVector<T>& b) const
+{
+  Factors<T> f;
+
+  factor(move(A), f);
+  solve(f, b);
+  A = move(f.Qt);
+}
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////
+/// @file refinement_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the RefinementSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class RefinementSolver
+/// @brief Mixed precision iterative refinement. The matrix is factored
+///        once by SOLVER in the cheaper type LOW, while residuals and the
+///        running solution are kept in the caller's type T. Like LAPACK's
+///        dsgesv it gives up on LOW when the factorization fails, the
+///        residual stops shrinking or max_iterations run out, and solves
+///        with SOLVER in T instead.
+/// @pre SOLVER must provide Factors<LOW>, factor() and solve() like
+///      GaussianSolver and QRSolver do.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn RefinementSolver(uint32_t max_iterations)
+/// @brief Constructor.
+/// @pre None.
+/// @post Refinement stops after at most max_iterations corrections.
+/// @param1 Upper bound on the number of corrections applied.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const DenseMatrix<T>& A, Factors<T>& f)
+/// @brief Keeps a copy of A in T and factors it in LOW, or in T when
+///        the LOW factorization fails.
+/// @pre A is square and nonsingular in T.
+/// @post f can be passed to solve() any number of times.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const Factors<T>& f, MathVector<T>& b)
+/// @brief Refines the solution for b in place, refactoring in T when
+///        refinement does not reach the accuracy of T.
+/// @pre f came from factor().
+/// @post b holds x, iterations() the number of corrections applied and
+///       refactored() whether the solve fell back to T.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b to the accuracy of T.
+/// @pre A is square and nonsingular.
+/// @post iterations() returns the number of corrections applied.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include "../matrices/dense_matrix.h"
+#include "../utilities/trace.h"
+#include "gaussian_solver.h"
+
+template <typename LOW, class SOLVER = GaussianSolver>
+class RefinementSolver
+{
+private:
+  uint32_t m_max_iterations;
+  uint32_t m_iterations;
+  bool m_refactored;
+
+public:
+  // A in the working type T next to its factors in LOW, or in T when
+  // LOW could not factor it
+  template <typename T>
+  struct Factors
+  {
+    DenseMatrix<T> A;
+    T norm_a;
+    typename SOLVER::template Factors<LOW> low;
+    bool full;
+    typename SOLVER::template Factors<T> high;
+  };
+
+  RefinementSolver(uint32_t max_iterations = 30) : m_max_iterations(max_iterations), m_iterations(0), m_refactored(false) {};
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+
+  uint32_t iterations() const { return m_iterations; }
+  bool refactored() const { return m_refactored; }
+};
+
+#include "refinement_solver.hpp"
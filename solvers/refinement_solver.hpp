@@ -0,0 +1,135 @@
+#pragma once
+
+template <typename LOW, class SOLVER>
+template <typename T>
+MathVector<T> RefinementSolver<LOW, SOLVER>::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <typename LOW, class SOLVER>
+template <typename T>
+void RefinementSolver<LOW, SOLVER>::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  uint32_t n = A.getNumRows();
+  SOLVER s;
+  DenseMatrix<LOW> A_low(n, A.getNumColumns());
+
+  // Round A down and factor it once
+  f.A = A;
+  f.norm_a = 0;
+  for(uint32_t i = 0; i < n; i++)
+  {
+    const T * row = A[i].data();
+    LOW * row_low = A_low[i].data();
+    T row_sum = 0;
+    for(uint32_t j = 0; j < A.getNumColumns(); j++)
+    {
+      row_low[j] = static_cast<LOW>(row[j]);
+      row_sum += fabs(row[j]);
+    }
+    f.norm_a = max(f.norm_a, row_sum);
+  }
+
+  // Entries that overflow LOW or a pivot lost to rounding send every
+  // solve straight to T
+  f.full = false;
+  try
+  {
+    s.factor(A_low, f.low);
+  }
+  catch(const domain_error&)
+  {
+    f.full = true;
+    s.factor(A, f.high);
+  }
+}
+
+template <typename LOW, class SOLVER>
+template <typename T>
+void RefinementSolver<LOW, SOLVER>::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  const DenseMatrix<T>& A = f.A;
+  const T norm_a = f.norm_a;
+  uint32_t n = A.getNumRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: RefinementSolver.");
+  SOLVER s;
+  m_iterations = 0;
+  m_refactored = f.full;
+  if(f.full)
+  {
+    s.solve(f.high, b);
+    return;
+  }
+
+  MathVector<LOW> d(n);
+  MathVector<T> x(n);
+
+  for(uint32_t i = 0; i < n; i++)
+  {
+    x.push(0);
+    d.push(0);
+  }
+
+  // x starts at 0 so the first residual is b and the first correction is
+  // the plain LOW solve
+  T last_norm_r = numeric_limits<T>::infinity();
+  bool converged = false;
+  for(uint32_t it = 0; it <= m_max_iterations; it++)
+  {
+    TraceSpan span("RefinementSolver::iteration");
+    MathVector<T> r = b;
+    T norm_r = 0;
+    T norm_x = 0;
+
+    // r = b - Ax in T
+    for(uint32_t i = 0; i < n; i++)
+    {
+      const T * row = A[i].data();
+      T sum = 0;
+      for(uint32_t j = 0; j < n; j++)
+        sum += row[j] * x.data()[j];
+      r.data()[i] -= sum;
+      norm_r = max(norm_r, static_cast<T>(fabs(r.data()[i])));
+      norm_x = max(norm_x, static_cast<T>(fabs(x.data()[i])));
+    }
+
+    // Same backward error test LAPACK's dsgesv uses for the working precision
+    if(norm_r == 0 || norm_r < norm_x * norm_a * sqrt(static_cast<T>(n)) * numeric_limits<T>::epsilon())
+    {
+      converged = true;
+      break;
+    }
+    // A correction that does not at least halve the residual means A is
+    // too badly conditioned for LOW, and more of them will not help
+    if(it == m_max_iterations || !isfinite(norm_r) || !(norm_r < last_norm_r / 2))
+      break;
+    last_norm_r = norm_r;
+
+    // Solve for the correction with r scaled to 1 so LOW cannot under or overflow
+    for(uint32_t i = 0; i < n; i++)
+      d.data()[i] = static_cast<LOW>(r.data()[i] / norm_r);
+    s.solve(f.low, d);
+
+    for(uint32_t i = 0; i < n; i++)
+      x.data()[i] += norm_r * static_cast<T>(d.data()[i]);
+    m_iterations++;
+  }
+
+  if(converged)
+  {
+    b = x;
+    return;
+  }
+  typename SOLVER::template Factors<T> high;
+  s.factor(A, high);
+  s.solve(high, b);
+  m_refactored = true;
+}
@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////
+/// @file schwarz_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SchwarzSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SchwarzSolver
+/// @brief Additive Schwarz domain decomposition for the Dirichlet grid
+///        operator. The (n-1) x (n-1) grid of unknowns is cut into
+///        overlapping rectangles, each factored once and solved on its
+///        own pool thread, and the summed subdomain solves (plus an
+///        optional bilinear coarse grid correction) precondition
+///        conjugate gradients on the whole grid.
+/// @pre The matrix is symmetric positive definite with one unknown per
+///      point of a square grid, numbered row by row as
+///      DirichletSolver::pointIndex does.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SchwarzSolver(uint32_t subdomains, uint32_t overlap, bool coarse, double tolerance, uint32_t max_iterations)
+/// @brief Constructor.
+/// @pre None.
+/// @post The grid will be cut into subdomains x subdomains pieces, each
+///       grown by overlap points on every side. subdomains = 0 picks
+///       enough for about SUBDOMAIN_SIDE x SUBDOMAIN_SIDE points each,
+///       so every subdomain's LU stays cache sized as the grid grows.
+/// @param1 Subdomains along each side of the grid, 0 to size them.
+/// @param2 Points each subdomain is extended by into its neighbours.
+/// @param3 Whether or not to add the coarse grid correction.
+/// @param4 CG stops once |r| <= tolerance * |b|.
+/// @param5 Upper bound on the number of CG iterations.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const DenseMatrix<T>& A, Factors<T>& f)
+/// @brief Keeps the nonzeros of A and factors every subdomain and the
+///        coarse operator.
+/// @pre A is (m*m) x (m*m) for some m.
+/// @post f can be passed to solve() any number of times.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const Factors<T>& f, MathVector<T>& b)
+/// @brief Preconditioned CG for b in place.
+/// @pre f came from factor().
+/// @post b holds x and iterations() the number of CG steps taken.
+///       Throws domain_error if max_iterations pass without reaching
+///       the tolerance.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b.
+/// @pre Same as factor().
+/// @post iterations() returns the number of CG steps taken.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
+#include "gaussian_solver.h"
+
+class SchwarzSolver
+{
+private:
+  uint32_t m_subdomains;
+  uint32_t m_overlap;
+  bool m_coarse;
+  double m_tolerance;
+  uint32_t m_max_iterations;
+  uint32_t m_iterations;
+
+public:
+  template <typename T>
+  struct Subdomain
+  {
+    vector<uint32_t> points;
+    GaussianSolver::Factors<T> lu;
+  };
+
+  // Nonzeros of A by row, the factored subdomains, and the coarse grid
+  // interpolation (up to four coarse points and weights per fine point)
+  template <typename T>
+  struct Factors
+  {
+    uint32_t side;
+    vector<uint32_t> row_start;
+    vector<uint32_t> columns;
+    vector<T> values;
+    vector<Subdomain<T>> subdomains;
+    uint32_t coarse_size;
+    vector<uint32_t> coarse_points;
+    vector<T> coarse_weights;
+    GaussianSolver::Factors<T> coarse_lu;
+  };
+
+  // Points along each side of a subdomain when the count is left to the
+  // solver
+  static const uint32_t SUBDOMAIN_SIDE = 16;
+
+  SchwarzSolver(uint32_t subdomains = 0, uint32_t overlap = 1, bool coarse = true,
+                double tolerance = 1e-12, uint32_t max_iterations = 500)
+    : m_subdomains(subdomains), m_overlap(overlap), m_coarse(coarse),
+      m_tolerance(tolerance), m_max_iterations(max_iterations), m_iterations(0) {};
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+
+  uint32_t iterations() const { return m_iterations; }
+
+private:
+  uint32_t subdomainCount(uint32_t side) const;
+  template <typename T>
+  void multiply(const Factors<T>& f, const T * x, T * y) const;
+  template <typename T>
+  void precondition(const Factors<T>& f, const T * r, T * z) const;
+  template <typename T>
+  void buildCoarse(Factors<T>& f) const;
+};
+
+#include "schwarz_solver.hpp"
@@ -0,0 +1,281 @@
+#pragma once
+
+template <typename T>
+MathVector<T> SchwarzSolver::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <typename T>
+void SchwarzSolver::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("SchwarzSolver::factor");
+  uint32_t n = A.getNumRows();
+  uint32_t side = static_cast<uint32_t>(round(sqrt(static_cast<double>(n))));
+  if(side * side != n || A.getNumColumns() != n)
+    throw domain_error("Matrix is not a square grid operator: SchwarzSolver.");
+  f.side = side;
+
+  // Only the handful of nonzeros per row are needed from here on
+  f.row_start.assign(1, 0);
+  f.columns.clear();
+  f.values.clear();
+  for(uint32_t i = 0; i < n; i++)
+  {
+    const T * row = A[i].data();
+    for(uint32_t j = 0; j < n; j++)
+      if(row[j] != T(0))
+      {
+        f.columns.push_back(j);
+        f.values.push_back(row[j]);
+      }
+    f.row_start.push_back(f.columns.size());
+  }
+
+  // Rectangles of the grid, each grown by the overlap
+  uint32_t s = subdomainCount(side);
+  f.subdomains.assign(s * s, Subdomain<T>());
+  ThreadPool::shared().parallelFor(0, s * s, 1, [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t d = first; d < last; d++)
+    {
+      TraceSpan local_span("SchwarzSolver::factorSubdomain");
+      uint32_t bx = d % s;
+      uint32_t by = d / s;
+      uint32_t x0 = side * bx / s;
+      uint32_t x1 = side * (bx + 1) / s;
+      uint32_t y0 = side * by / s;
+      uint32_t y1 = side * (by + 1) / s;
+      x0 = x0 > m_overlap ? x0 - m_overlap : 0;
+      y0 = y0 > m_overlap ? y0 - m_overlap : 0;
+      x1 = min(side, x1 + m_overlap);
+      y1 = min(side, y1 + m_overlap);
+
+      Subdomain<T>& sub = f.subdomains[d];
+      uint32_t width = x1 - x0;
+      uint32_t k = width * (y1 - y0);
+      DenseMatrix<T> local(k, k);
+      sub.points.resize(k);
+      for(uint32_t y = y0; y < y1; y++)
+        for(uint32_t x = x0; x < x1; x++)
+        {
+          uint32_t a = (y - y0) * width + (x - x0);
+          uint32_t p = y * side + x;
+          sub.points[a] = p;
+          for(uint32_t e = f.row_start[p]; e < f.row_start[p + 1]; e++)
+          {
+            uint32_t cx = f.columns[e] % side;
+            uint32_t cy = f.columns[e] / side;
+            if(cx >= x0 && cx < x1 && cy >= y0 && cy < y1)
+              local[a].data()[(cy - y0) * width + (cx - x0)] = f.values[e];
+          }
+        }
+      GaussianSolver().factor(move(local), sub.lu);
+    }
+  });
+
+  f.coarse_size = 0;
+  if(m_coarse && s >= 2)
+    buildCoarse(f);
+}
+
+inline uint32_t SchwarzSolver::subdomainCount(uint32_t side) const
+{
+  uint32_t s = m_subdomains == 0 ? (side + SUBDOMAIN_SIDE - 1) / SUBDOMAIN_SIDE : m_subdomains;
+  return max(1u, min(s, side));
+}
+
+template <typename T>
+void SchwarzSolver::buildCoarse(Factors<T>& f) const
+{
+  TraceSpan span("SchwarzSolver::buildCoarse");
+  uint32_t side = f.side;
+  uint32_t n = side * side;
+  uint32_t s = subdomainCount(side);
+  uint32_t nc = s - 1;
+  f.coarse_size = nc * nc;
+
+  // Coarse node k sits at grid coordinate k * (side + 1) / s, with nodes
+  // 0 and s on the boundary where the correction is zero. Fine point x
+  // sits at x + 1 and takes the bilinear weights of its cell's corners.
+  f.coarse_points.assign(4 * n, 0);
+  f.coarse_weights.assign(4 * n, T(0));
+  auto cell = [&](uint32_t x, uint32_t& k, T& t)
+  {
+    T g = T(x + 1) * s / (side + 1);
+    k = min(static_cast<uint32_t>(g), s - 1);
+    t = g - k;
+  };
+  for(uint32_t y = 0; y < side; y++)
+    for(uint32_t x = 0; x < side; x++)
+    {
+      uint32_t kx, ky;
+      T tx, ty;
+      cell(x, kx, tx);
+      cell(y, ky, ty);
+      uint32_t p = y * side + x;
+      for(uint32_t c = 0; c < 4; c++)
+      {
+        uint32_t cx = kx + (c & 1);
+        uint32_t cy = ky + (c >> 1);
+        if(cx == 0 || cx == s || cy == 0 || cy == s)
+          continue;
+        f.coarse_points[4 * p + c] = (cy - 1) * nc + (cx - 1);
+        f.coarse_weights[4 * p + c] = ((c & 1) ? tx : 1 - tx) * ((c >> 1) ? ty : 1 - ty);
+      }
+    }
+
+  // Galerkin operator P^T A P, one column at a time
+  DenseMatrix<T> coarse(f.coarse_size, f.coarse_size);
+  vector<T> column(n);
+  vector<T> product(n);
+  for(uint32_t j = 0; j < f.coarse_size; j++)
+  {
+    for(uint32_t p = 0; p < n; p++)
+    {
+      column[p] = 0;
+      for(uint32_t c = 0; c < 4; c++)
+        if(f.coarse_points[4 * p + c] == j)
+          column[p] += f.coarse_weights[4 * p + c];
+    }
+    multiply(f, column.data(), product.data());
+    for(uint32_t p = 0; p < n; p++)
+      for(uint32_t c = 0; c < 4; c++)
+        coarse[f.coarse_points[4 * p + c]].data()[j] += f.coarse_weights[4 * p + c] * product[p];
+  }
+  GaussianSolver().factor(move(coarse), f.coarse_lu);
+}
+
+template <typename T>
+void SchwarzSolver::multiply(const Factors<T>& f, const T * x, T * y) const
+{
+  uint32_t n = f.row_start.size() - 1;
+  ThreadPool::shared().parallelFor(0, n, 4096, [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t i = first; i < last; i++)
+    {
+      T sum = 0;
+      for(uint32_t e = f.row_start[i]; e < f.row_start[i + 1]; e++)
+        sum += f.values[e] * x[f.columns[e]];
+      y[i] = sum;
+    }
+  });
+}
+
+template <typename T>
+void SchwarzSolver::precondition(const Factors<T>& f, const T * r, T * z) const
+{
+  TraceSpan span("SchwarzSolver::precondition");
+  uint32_t n = f.row_start.size() - 1;
+  uint32_t count = f.subdomains.size();
+  bool coarse = f.coarse_size > 0;
+  vector<MathVector<T>> local(count + (coarse ? 1 : 0));
+
+  // Every subdomain, and the coarse grid as one more task, is independent
+  ThreadPool::shared().parallelFor(0, local.size(), 1, [&](uint32_t first, uint32_t last)
+  {
+    GaussianSolver solver;
+    for(uint32_t d = first; d < last; d++)
+    {
+      if(d < count)
+      {
+        TraceSpan local_span("SchwarzSolver::solveSubdomain");
+        const Subdomain<T>& sub = f.subdomains[d];
+        local[d] = MathVector<T>(sub.points.size());
+        for(uint32_t a = 0; a < sub.points.size(); a++)
+          local[d].push(r[sub.points[a]]);
+        solver.solve(sub.lu, local[d]);
+      }
+      else
+      {
+        TraceSpan coarse_span("SchwarzSolver::solveCoarse");
+        local[d] = MathVector<T>(f.coarse_size);
+        for(uint32_t j = 0; j < f.coarse_size; j++)
+          local[d].push(0);
+        T * rc = local[d].data();
+        for(uint32_t p = 0; p < n; p++)
+          for(uint32_t c = 0; c < 4; c++)
+            rc[f.coarse_points[4 * p + c]] += f.coarse_weights[4 * p + c] * r[p];
+        solver.solve(f.coarse_lu, local[d]);
+      }
+    }
+  });
+
+  fill(z, z + n, T(0));
+  for(uint32_t d = 0; d < count; d++)
+  {
+    const vector<uint32_t>& points = f.subdomains[d].points;
+    const T * x = local[d].data();
+    for(uint32_t a = 0; a < points.size(); a++)
+      z[points[a]] += x[a];
+  }
+  if(coarse)
+  {
+    const T * xc = local[count].data();
+    for(uint32_t p = 0; p < n; p++)
+      for(uint32_t c = 0; c < 4; c++)
+        z[p] += f.coarse_weights[4 * p + c] * xc[f.coarse_points[4 * p + c]];
+  }
+}
+
+template <typename T>
+void SchwarzSolver::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  TraceSpan span("SchwarzSolver::solve");
+  uint32_t n = f.row_start.size() - 1;
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: SchwarzSolver.");
+
+  vector<T> x(n, T(0));
+  vector<T> r(b.data(), b.data() + n);
+  vector<T> z(n);
+  vector<T> p(n);
+  vector<T> q(n);
+  auto dot = [n](const vector<T>& u, const vector<T>& v)
+  {
+    T sum = 0;
+    for(uint32_t i = 0; i < n; i++)
+      sum += u[i] * v[i];
+    return sum;
+  };
+
+  T norm_b = sqrt(dot(r, r));
+  precondition(f, r.data(), z.data());
+  p = z;
+  T rz = dot(r, z);
+
+  m_iterations = 0;
+  bool converged = norm_b == T(0);
+  while(!converged && m_iterations < m_max_iterations)
+  {
+    TraceSpan iteration_span("SchwarzSolver::iteration");
+    multiply(f, p.data(), q.data());
+    T alpha = rz / dot(p, q);
+    for(uint32_t i = 0; i < n; i++)
+    {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+    }
+    m_iterations++;
+    converged = sqrt(dot(r, r)) <= m_tolerance * norm_b;
+    if(converged)
+      break;
+
+    precondition(f, r.data(), z.data());
+    T rz_next = dot(r, z);
+    T beta = rz_next / rz;
+    rz = rz_next;
+    for(uint32_t i = 0; i < n; i++)
+      p[i] = z[i] + beta * p[i];
+  }
+  if(!converged)
+    throw domain_error("CG did not converge: SchwarzSolver.");
+
+  copy(x.begin(), x.end(), b.data());
+}
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////
+/// @file skyline_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SkylineSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SkylineSolver
+/// @brief Direct solver that works only inside the envelope of the
+///        matrix. The rows are first renumbered by reverse Cuthill-McKee
+///        to pull the nonzeros towards the diagonal, then the matrix is
+///        stored as a SkylineMatrix and factored in place, LU or
+///        Cholesky. With bandwidth b that is O(N b) memory and
+///        O(N b^2) work instead of O(N^2) and O(N^3) for GaussianSolver.
+///        There is no pivoting, since row swaps would leave the envelope.
+/// @pre For LU the matrix has a symmetric pattern and needs no pivoting,
+///      e.g. it is diagonally dominant. For CHOLESKY it is symmetric
+///      positive definite.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SkylineSolver(Method method)
+/// @brief Constructor.
+/// @pre None.
+/// @post Factors are computed with method, LU by default.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const SparseMatrix<T>& A, Factors<T>& f)
+/// @fn void factor(const DenseMatrix<T>& A, Factors<T>& f)
+/// @brief Orders, stores and factors A. A dense A is compressed first.
+/// @pre Same as the class.
+/// @post f can be passed to solve() any number of times. Throws
+///       domain_error on a zero pivot, or for CHOLESKY if A is not
+///       positive definite.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const Factors<T>& f, MathVector<T>& b)
+/// @brief Forward and back substitution along the envelope.
+/// @pre f came from factor() and b has one entry per row.
+/// @post b holds x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b.
+/// @pre Same as the class.
+/// @post None.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/skyline_matrix.h"
+#include "../matrices/sparse_matrix.h"
+#include "../utilities/sparse_ordering.h"
+#include "../utilities/trace.h"
+
+class SkylineSolver
+{
+public:
+  enum Method { LU, CHOLESKY };
+
+  // The envelope of P A P^T holding unit L below the diagonal and U on
+  // and above it, or L alone for CHOLESKY. order[k] is the row of A that
+  // became row k.
+  template <typename T>
+  struct Factors
+  {
+    vector<uint32_t> order;
+    SkylineMatrix<T> LU;
+  };
+
+  SkylineSolver(Method method = LU) : m_method(method) {};
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void factor(const SparseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+
+private:
+  Method m_method;
+};
+
+#include "skyline_solver.hpp"
@@ -0,0 +1,117 @@
+#pragma once
+
+template <typename T>
+MathVector<T> SkylineSolver::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <typename T>
+void SkylineSolver::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  factor(SparseMatrix<T>(A), f);
+}
+
+template <typename T>
+void SkylineSolver::factor(const SparseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("SkylineSolver::factor");
+  bool cholesky = m_method == CHOLESKY;
+  f.order = reverse_cuthill_mckee(A);
+  f.LU = SkylineMatrix<T>(A, f.order, cholesky);
+
+  // Row i of L and column i of U only need rows and columns before i, so
+  // each step is a run of dot products over the overlap of two envelopes
+  SkylineMatrix<T>& S = f.LU;
+  T * d = S.diagonal();
+  for(uint32_t i = 0; i < S.getNumRows(); i++)
+  {
+    uint32_t fi = S.first(i);
+    T * l_i = S.lower(i);
+    T * u_i = S.upper(i);
+    for(uint32_t j = fi; j < i; j++)
+    {
+      uint32_t fj = S.first(j);
+      uint32_t p0 = max(fi, fj);
+      uint32_t length = j - p0;
+      // Entries p0 .. j - 1 of row i, column i, row j and column j
+      const T * l_ip = l_i + (p0 - fi);
+      const T * u_ip = u_i + (p0 - fi);
+      const T * l_jp = S.lower(j) + (p0 - fj);
+      const T * u_jp = S.upper(j) + (p0 - fj);
+      T sum_l = 0;
+      T sum_u = 0;
+      if(cholesky)
+        for(uint32_t k = 0; k < length; k++)
+          sum_l += l_ip[k] * l_jp[k];
+      else
+        for(uint32_t k = 0; k < length; k++)
+        {
+          sum_l += l_ip[k] * u_jp[k];
+          sum_u += l_jp[k] * u_ip[k];
+        }
+      l_i[j - fi] = (l_i[j - fi] - sum_l) / d[j];
+      if(!cholesky)
+        u_i[j - fi] -= sum_u;
+    }
+
+    T pivot = d[i];
+    for(uint32_t k = 0; k < i - fi; k++)
+      pivot -= l_i[k] * u_i[k];
+    if(cholesky)
+    {
+      if(!(pivot > T(0)))
+        throw domain_error("Matrix is not positive definite: SkylineSolver.");
+      pivot = sqrt(pivot);
+    }
+    else if(pivot == T(0))
+      throw domain_error("Zero pivot: SkylineSolver.");
+    d[i] = pivot;
+  }
+}
+
+template <typename T>
+void SkylineSolver::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  TraceSpan span("SkylineSolver::solve");
+  const SkylineMatrix<T>& S = f.LU;
+  uint32_t n = S.getNumRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: SkylineSolver.");
+  bool cholesky = S.symmetric();
+  const T * d = S.diagonal();
+  T * bs = b.data();
+  vector<T> y(n);
+  for(uint32_t k = 0; k < n; k++)
+    y[k] = bs[f.order[k]];
+
+  // L y = P b, unit L for LU
+  for(uint32_t i = 0; i < n; i++)
+  {
+    uint32_t fi = S.first(i);
+    const T * l = S.lower(i);
+    T sum = y[i];
+    for(uint32_t k = 0; k < i - fi; k++)
+      sum -= l[k] * y[fi + k];
+    y[i] = cholesky ? sum / d[i] : sum;
+  }
+
+  // U x = y (L^T for Cholesky) a column at a time
+  for(uint32_t i = n; i-- > 0;)
+  {
+    uint32_t fi = S.first(i);
+    const T * u = S.upper(i);
+    y[i] /= d[i];
+    for(uint32_t k = 0; k < i - fi; k++)
+      y[fi + k] -= u[k] * y[i];
+  }
+
+  for(uint32_t k = 0; k < n; k++)
+    bs[f.order[k]] = y[k];
+}
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////
+/// @file sor_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SORSolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SORSolver
+/// @brief Red-black successive over-relaxation for the Dirichlet grid
+///        operator. Points with x + y even are red and only touch black
+///        points, so each colour's sweep has no dependencies inside it
+///        and is split across the shared pool. Only the nonzeros of A
+///        are kept.
+/// @pre The matrix has one unknown per point of a square grid, numbered
+///      row by row as DirichletSolver::pointIndex does, and couples
+///      each point only to points of the other colour.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SORSolver(double omega, double tolerance, uint32_t max_iterations)
+/// @brief Constructor.
+/// @pre 0 < omega < 2, or omega is 0.
+/// @post With omega 0 the relaxation factor is picked per grid as
+///       2 / (1 + sin(pi / n)), optimal for the spacing 1 / n.
+/// @param1 Relaxation factor, 1 for plain Gauss-Seidel.
+/// @param2 Sweeps stop once |r| <= tolerance * |b|.
+/// @param3 Upper bound on the number of red-black sweeps.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const DenseMatrix<T>& A, Factors<T>& f)
+/// @brief Splits the nonzeros of A by colour. Nothing is factored; the
+///        name keeps the protocol DirichletSolver expects.
+/// @pre A is (m*m) x (m*m) for some m with a nonzero diagonal.
+/// @post f can be passed to solve() any number of times.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const Factors<T>& f, MathVector<T>& b)
+/// @brief Sweeps from x = 0 until the residual is small enough.
+/// @pre f came from factor().
+/// @post b holds x and iterations() the number of sweeps taken.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b.
+/// @pre Same as factor().
+/// @post iterations() returns the number of sweeps taken.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
+
+class SORSolver
+{
+private:
+  double m_omega;
+  double m_tolerance;
+  uint32_t m_max_iterations;
+  uint32_t m_iterations;
+
+public:
+  // One colour's points with their off-diagonal nonzeros by row
+  template <typename T>
+  struct Colour
+  {
+    vector<uint32_t> points;
+    vector<T> inverse_diagonal;
+    vector<uint32_t> row_start;
+    vector<uint32_t> columns;
+    vector<T> values;
+  };
+
+  template <typename T>
+  struct Factors
+  {
+    Colour<T> red;
+    Colour<T> black;
+    T omega;
+  };
+
+  SORSolver(double omega = 0, double tolerance = 1e-10, uint32_t max_iterations = 100000)
+    : m_omega(omega), m_tolerance(tolerance), m_max_iterations(max_iterations), m_iterations(0) {};
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+
+  uint32_t iterations() const { return m_iterations; }
+
+private:
+  // Relaxes every point of c, returning the squared residual seen
+  template <typename T>
+  T sweep(const Colour<T>& c, T omega, const T * b, T * x) const;
+};
+
+#include "sor_solver.hpp"
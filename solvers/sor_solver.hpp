@@ -0,0 +1,118 @@
+#pragma once
+
+template <typename T>
+MathVector<T> SORSolver::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <typename T>
+void SORSolver::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  TraceSpan span("SORSolver::factor");
+  uint32_t n = A.getNumRows();
+  uint32_t side = static_cast<uint32_t>(round(sqrt(static_cast<double>(n))));
+  if(side * side != n || A.getNumColumns() != n)
+    throw domain_error("Matrix is not a square grid operator: SORSolver.");
+
+  auto red = [side](uint32_t p) { return (p % side + p / side) % 2 == 0; };
+  for(Colour<T>* c : {&f.red, &f.black})
+  {
+    c->points.clear();
+    c->inverse_diagonal.clear();
+    c->row_start.assign(1, 0);
+    c->columns.clear();
+    c->values.clear();
+  }
+
+  for(uint32_t i = 0; i < n; i++)
+  {
+    Colour<T>& c = red(i) ? f.red : f.black;
+    const T * row = A[i].data();
+    if(row[i] == T(0))
+      throw domain_error("Zero on the diagonal: SORSolver.");
+
+    c.points.push_back(i);
+    c.inverse_diagonal.push_back(T(1) / row[i]);
+    for(uint32_t j = 0; j < n; j++)
+    {
+      if(j == i || row[j] == T(0))
+        continue;
+      if(red(j) == red(i))
+        throw domain_error("Matrix couples points of one colour: SORSolver.");
+      c.columns.push_back(j);
+      c.values.push_back(row[j]);
+    }
+    c.row_start.push_back(c.columns.size());
+  }
+
+  // Grid spacing is 1 / n for the (n-1) x (n-1) interior points
+  f.omega = m_omega > 0 ? T(m_omega) : T(2 / (1 + sin(M_PI / (side + 1))));
+}
+
+template <typename T>
+T SORSolver::sweep(const Colour<T>& c, T omega, const T * b, T * x) const
+{
+  const uint32_t GRAIN = 4096;
+  uint32_t count = c.points.size();
+  uint32_t chunks = (count + GRAIN - 1) / GRAIN;
+  vector<T> partial(chunks, T(0));
+
+  ThreadPool::shared().parallelFor(0, count, GRAIN, [&](uint32_t first, uint32_t last)
+  {
+    T sum = 0;
+    for(uint32_t k = first; k < last; k++)
+    {
+      uint32_t p = c.points[k];
+      T r = b[p] - x[p] / c.inverse_diagonal[k];
+      for(uint32_t e = c.row_start[k]; e < c.row_start[k + 1]; e++)
+        r -= c.values[e] * x[c.columns[e]];
+      x[p] += omega * r * c.inverse_diagonal[k];
+      sum += r * r;
+    }
+    partial[first / GRAIN] = sum;
+  });
+
+  T total = 0;
+  for(uint32_t i = 0; i < chunks; i++)
+    total += partial[i];
+  return total;
+}
+
+template <typename T>
+void SORSolver::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  TraceSpan span("SORSolver::solve");
+  uint32_t n = f.red.points.size() + f.black.points.size();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: SORSolver.");
+
+  vector<T> x(n, T(0));
+  const T * rhs = b.data();
+  T norm_b = 0;
+  for(uint32_t i = 0; i < n; i++)
+    norm_b += rhs[i] * rhs[i];
+  T limit = T(m_tolerance * m_tolerance) * norm_b;
+
+  // The residual of each point is already formed just before it is
+  // relaxed, so the stopping test costs no extra product with A. It
+  // lags one half sweep behind the true residual.
+  m_iterations = 0;
+  while(norm_b > T(0) && m_iterations < m_max_iterations)
+  {
+    TraceSpan iteration_span("SORSolver::iteration");
+    T norm_r = sweep(f.red, f.omega, rhs, x.data());
+    norm_r += sweep(f.black, f.omega, rhs, x.data());
+    m_iterations++;
+    if(norm_r <= limit)
+      break;
+  }
+
+  copy(x.begin(), x.end(), b.data());
+}
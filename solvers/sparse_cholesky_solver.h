@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////
+/// @file sparse_cholesky_solver.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SparseCholeskySolver class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SparseCholeskySolver
+/// @brief Supernodal multifrontal Cholesky for sparse symmetric positive
+///        definite matrices. The symbolic phase finds the elimination
+///        tree and the structure of L under a fill reducing order, then
+///        groups columns with the same structure into supernodes. Each
+///        supernode is factored as a dense front: Cholesky of its
+///        diagonal block, a triangular solve for the rows below and a
+///        blocked rank-k update passed to its parent. Supernodes on the
+///        same level of the tree are independent and run across the
+///        shared pool.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const SparseMatrix<T>& A, const vector<uint32_t>& order, Factors<T>& f)
+/// @brief Factors P A P^T = L L^T, where order[k] is the row of A that
+///        becomes row k.
+/// @pre A is symmetric positive definite and order is a permutation of
+///      its rows. Only the lower triangle of A is read.
+/// @post f can be passed to solve() any number of times. Throws
+///       domain_error if A is not positive definite.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const SparseMatrix<T>& A, Factors<T>& f)
+/// @fn void factor(const DenseMatrix<T>& A, Factors<T>& f)
+/// @brief Same as above with grid_nested_dissection as the order when
+///        A has m * m rows, taking it to be a grid operator numbered as
+///        DirichletSolver::pointIndex does, and the natural order
+///        otherwise. Any order is correct, the grid one just keeps the
+///        fill low. A dense A is compressed first.
+/// @pre A is symmetric positive definite.
+/// @post f can be passed to solve() any number of times.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void solve(const Factors<T>& f, MathVector<T>& b)
+/// @brief Forward and back substitution through the supernodes.
+/// @pre f came from factor() and b has one entry per row.
+/// @post b holds x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> operator ()(const DenseMatrix<T>& A, const MathVector<T>& b)
+/// @brief Solves Ax = b.
+/// @pre Same as factor().
+/// @post None.
+/// @param1 Coefficient matrix.
+/// @param2 Right hand side.
+/// @return Returns x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> solveGrid(int32_t n)
+/// @brief Solves the Dirichlet problem with spacing 1 / n for the
+///        boundary functions DirichletSolver takes, assembling the
+///        operator straight into a SparseMatrix.
+/// @pre n > 1.
+/// @post None.
+/// @return Returns x, numbered as DirichletSolver::pointIndex does.
+//////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cmath>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/sparse_matrix.h"
+#include "../utilities/blas.h"
+#include "../utilities/grid_ordering.h"
+#include "../utilities/thread_pool.h"
+#include "../utilities/trace.h"
+
+class SparseCholeskySolver
+{
+public:
+  // Columns first .. last - 1 of L, which share the structure rows below
+  // them. diagonal holds their lower triangle and row q of below holds
+  // column first + q of L at the rows listed in rows.
+  template <typename T>
+  struct Supernode
+  {
+    uint32_t first;
+    uint32_t last;
+    vector<uint32_t> rows;
+    DenseMatrix<T> diagonal;
+    DenseMatrix<T> below;
+  };
+
+  template <typename T>
+  struct Factors
+  {
+    // order[k] is the row of A that became row k of L
+    vector<uint32_t> order;
+    vector<Supernode<T>> supernodes;
+  };
+
+  template <typename T>
+  MathVector<T> operator()(const DenseMatrix<T>& A, const MathVector<T>& b);
+
+  template <typename T>
+  void factor(const DenseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void factor(const SparseMatrix<T>& A, Factors<T>& f);
+  template <typename T>
+  void factor(const SparseMatrix<T>& A, const vector<uint32_t>& order, Factors<T>& f);
+  template <typename T>
+  void solve(const Factors<T>& f, MathVector<T>& b);
+
+  template <typename T, long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
+  MathVector<T> solveGrid(int32_t n);
+
+private:
+  // Fronts at least this wide split their dense kernels across the pool
+  static const uint32_t PARALLEL_WIDTH = 64;
+  // Chains of columns are merged into one supernode up to this width
+  // even where their structures differ
+  static const uint32_t RELAXED_WIDTH = 16;
+
+  // Dense kernels on one front: D = L L^T in place, B = L^-1 B for the
+  // transposed rows below it, then U -= B^T B on and below the diagonal
+  template <typename T>
+  static void factorDiagonal(DenseMatrix<T>& D);
+  template <typename T>
+  static void solveBelow(const DenseMatrix<T>& D, DenseMatrix<T>& B);
+  template <typename T>
+  static void updateLower(const DenseMatrix<T>& B, DenseMatrix<T>& U);
+};
+
+#include "sparse_cholesky_solver.hpp"
@@ -0,0 +1,463 @@
+#pragma once
+
+#include <numeric>
+#include "dirichlet_solver.h"
+
+template <typename T>
+MathVector<T> SparseCholeskySolver::operator()(const DenseMatrix<T>& A, const MathVector<T>& b)
+{
+  Factors<T> f;
+  MathVector<T> x = b;
+
+  factor(A, f);
+  solve(f, x);
+
+  return x;
+}
+
+template <typename T>
+void SparseCholeskySolver::factor(const DenseMatrix<T>& A, Factors<T>& f)
+{
+  factor(SparseMatrix<T>(A), f);
+}
+
+template <typename T>
+void SparseCholeskySolver::factor(const SparseMatrix<T>& A, Factors<T>& f)
+{
+  uint32_t n = A.getNumRows();
+  uint32_t side = static_cast<uint32_t>(round(sqrt(static_cast<double>(n))));
+  vector<uint32_t> order;
+  if(side * side == n)
+    order = grid_nested_dissection(side, side);
+  else
+  {
+    order.resize(n);
+    iota(order.begin(), order.end(), 0);
+  }
+  factor(A, order, f);
+}
+
+template <typename T>
+void SparseCholeskySolver::factor(const SparseMatrix<T>& A, const vector<uint32_t>& order, Factors<T>& f)
+{
+  TraceSpan span("SparseCholeskySolver::factor");
+  uint32_t n = A.getNumRows();
+  if(A.getNumColumns() != n)
+    throw domain_error("Matrix is not square: SparseCholeskySolver.");
+  if(order.size() != n)
+    throw domain_error("Order size not compatible: SparseCholeskySolver.");
+  vector<uint32_t> position(n, UINT32_MAX);
+  for(uint32_t k = 0; k < n; k++)
+  {
+    if(order[k] >= n || position[order[k]] != UINT32_MAX)
+      throw domain_error("Order is not a permutation: SparseCholeskySolver.");
+    position[order[k]] = k;
+  }
+
+  // Lower triangle of P A P^T by columns, column j holding rows i > j
+  // sorted, plus the diagonal on its own
+  const uint32_t * row_start = A.rowStart();
+  const uint32_t * columns = A.columns();
+  const T * values = A.values();
+  vector<T> diagonal(n, T(0));
+  vector<uint32_t> lower_start(n + 1, 0);
+  for(uint32_t r = 0; r < n; r++)
+    for(uint32_t e = row_start[r]; e < row_start[r + 1] && columns[e] < r; e++)
+      lower_start[min(position[r], position[columns[e]]) + 1]++;
+  for(uint32_t j = 0; j < n; j++)
+    lower_start[j + 1] += lower_start[j];
+  vector<pair<uint32_t, T>> lower(lower_start[n]);
+  vector<uint32_t> fill_at(lower_start.begin(), lower_start.end() - 1);
+  for(uint32_t r = 0; r < n; r++)
+    for(uint32_t e = row_start[r]; e < row_start[r + 1] && columns[e] <= r; e++)
+    {
+      uint32_t pr = position[r];
+      uint32_t pc = position[columns[e]];
+      if(pr == pc)
+        diagonal[pr] = values[e];
+      else
+        lower[fill_at[min(pr, pc)]++] = make_pair(max(pr, pc), values[e]);
+    }
+  for(uint32_t j = 0; j < n; j++)
+    sort(lower.begin() + lower_start[j], lower.begin() + lower_start[j + 1],
+         [](const pair<uint32_t, T>& a, const pair<uint32_t, T>& b) { return a.first < b.first; });
+
+  // Symbolic: the structure of column j of L is its own entries plus
+  // those of its children in the elimination tree, j's parent being the
+  // first row in it
+  vector<vector<uint32_t>> structure(n);
+  vector<vector<uint32_t>> children(n);
+  vector<uint32_t> mark(n, UINT32_MAX);
+  for(uint32_t j = 0; j < n; j++)
+  {
+    vector<uint32_t>& rows = structure[j];
+    mark[j] = j;
+    for(uint32_t e = lower_start[j]; e < lower_start[j + 1]; e++)
+    {
+      mark[lower[e].first] = j;
+      rows.push_back(lower[e].first);
+    }
+    for(uint32_t c : children[j])
+      for(uint32_t i : structure[c])
+        if(mark[i] != j)
+        {
+          mark[i] = j;
+          rows.push_back(i);
+        }
+    sort(rows.begin(), rows.end());
+    if(!rows.empty())
+      children[rows[0]].push_back(j);
+  }
+
+  // Column j joins j - 1's supernode when it is j - 1's parent and
+  // column j - 1 has nothing below j that column j lacks, or while the
+  // supernode is narrow enough that the zeros it adds cost less than
+  // another front would
+  vector<uint32_t> supernode_of(n);
+  f.order = order;
+  f.supernodes.clear();
+  uint32_t count = 0;
+  vector<uint32_t> firsts;
+  for(uint32_t j = 0; j < n; j++)
+  {
+    bool chained = j > 0 && !structure[j - 1].empty() && structure[j - 1][0] == j;
+    bool same = chained && structure[j - 1].size() == structure[j].size() + 1;
+    if(!same && !(chained && j - firsts.back() < RELAXED_WIDTH))
+    {
+      firsts.push_back(j);
+      count++;
+    }
+    supernode_of[j] = count - 1;
+  }
+  firsts.push_back(n);
+  f.supernodes.resize(count);
+  vector<vector<uint32_t>> kids(count);
+  vector<uint32_t> level(count, 0);
+  uint32_t depth = 0;
+  for(uint32_t s = 0; s < count; s++)
+  {
+    Supernode<T>& node = f.supernodes[s];
+    node.first = firsts[s];
+    node.last = firsts[s + 1];
+    node.rows = move(structure[node.last - 1]);
+    if(!node.rows.empty())
+    {
+      uint32_t parent = supernode_of[node.rows[0]];
+      kids[parent].push_back(s);
+      level[parent] = max(level[parent], level[s] + 1);
+    }
+    depth = max(depth, level[s] + 1);
+  }
+  structure.clear();
+  children.clear();
+  vector<vector<uint32_t>> levels(depth);
+  for(uint32_t s = 0; s < count; s++)
+    levels[level[s]].push_back(s);
+
+  // Numeric: each front gathers its columns of A and its children's
+  // updates, is factored densely, and leaves its own update for the parent
+  vector<DenseMatrix<T>> updates(count);
+  auto front = [&](uint32_t s)
+  {
+    Supernode<T>& node = f.supernodes[s];
+    uint32_t w = node.last - node.first;
+    uint32_t r = node.rows.size();
+    DenseMatrix<T>& D = node.diagonal;
+    DenseMatrix<T>& B = node.below;
+    D = DenseMatrix<T>(w, w);
+    B = DenseMatrix<T>(w, r);
+    DenseMatrix<T> update = r > 0 ? DenseMatrix<T>(r, r) : DenseMatrix<T>();
+
+    for(uint32_t q = 0; q < w; q++)
+    {
+      uint32_t j = node.first + q;
+      D[q].data()[q] += diagonal[j];
+      uint32_t k = 0;
+      for(uint32_t e = lower_start[j]; e < lower_start[j + 1]; e++)
+      {
+        uint32_t i = lower[e].first;
+        if(i < node.last)
+          D[i - node.first].data()[q] += lower[e].second;
+        else
+        {
+          while(node.rows[k] != i)
+            k++;
+          B[q].data()[k] += lower[e].second;
+        }
+      }
+    }
+
+    // Extend-add: the child's rows are sorted and all in this front, so
+    // one merge finds where each lands
+    vector<uint32_t> local;
+    for(uint32_t c : kids[s])
+    {
+      const vector<uint32_t>& child_rows = f.supernodes[c].rows;
+      const DenseMatrix<T>& U = updates[c];
+      uint32_t m = child_rows.size();
+      local.resize(m);
+      uint32_t inside = 0;
+      uint32_t k = 0;
+      for(uint32_t a = 0; a < m; a++)
+      {
+        uint32_t i = child_rows[a];
+        if(i < node.last)
+        {
+          local[a] = i - node.first;
+          inside++;
+        }
+        else
+        {
+          while(node.rows[k] != i)
+            k++;
+          local[a] = k;
+        }
+      }
+      for(uint32_t a = 0; a < m; a++)
+      {
+        const T * u = U[a].data();
+        if(a < inside)
+        {
+          T * d = D[local[a]].data();
+          for(uint32_t b = 0; b <= a; b++)
+            d[local[b]] += u[b];
+        }
+        else
+        {
+          T * up = update[local[a]].data();
+          for(uint32_t b = 0; b < inside; b++)
+            B[local[b]].data()[local[a]] += u[b];
+          for(uint32_t b = inside; b <= a; b++)
+            up[local[b]] += u[b];
+        }
+      }
+      updates[c] = DenseMatrix<T>();
+    }
+
+    factorDiagonal(D);
+    if(r > 0)
+    {
+      solveBelow(D, B);
+      updateLower(B, update);
+      updates[s] = move(update);
+    }
+  };
+
+  for(uint32_t l = 0; l < depth; l++)
+  {
+    const vector<uint32_t>& fronts = levels[l];
+    ThreadPool::shared().parallelFor(0, fronts.size(), 1, [&](uint32_t first, uint32_t last)
+    {
+      for(uint32_t t = first; t < last; t++)
+        front(fronts[t]);
+    });
+  }
+}
+
+template <typename T>
+void SparseCholeskySolver::solve(const Factors<T>& f, MathVector<T>& b)
+{
+  TraceSpan span("SparseCholeskySolver::solve");
+  uint32_t n = f.order.size();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: SparseCholeskySolver.");
+  T * bs = b.data();
+  vector<T> y(n);
+  for(uint32_t k = 0; k < n; k++)
+    y[k] = bs[f.order[k]];
+
+  // L y = P b
+  for(const Supernode<T>& node : f.supernodes)
+  {
+    uint32_t w = node.last - node.first;
+    T * ys = y.data() + node.first;
+    for(uint32_t i = 0; i < w; i++)
+    {
+      const T * d = node.diagonal[i].data();
+      T sum = ys[i];
+      for(uint32_t p = 0; p < i; p++)
+        sum -= d[p] * ys[p];
+      ys[i] = sum / d[i];
+    }
+    for(uint32_t q = 0; q < w; q++)
+    {
+      const T * below = node.below[q].data();
+      for(uint32_t k = 0; k < node.rows.size(); k++)
+        y[node.rows[k]] -= below[k] * ys[q];
+    }
+  }
+
+  // L^T z = y, then x = P^T z
+  for(uint32_t s = f.supernodes.size(); s-- > 0;)
+  {
+    const Supernode<T>& node = f.supernodes[s];
+    uint32_t w = node.last - node.first;
+    T * ys = y.data() + node.first;
+    for(uint32_t q = 0; q < w; q++)
+    {
+      const T * below = node.below[q].data();
+      T sum = 0;
+      for(uint32_t k = 0; k < node.rows.size(); k++)
+        sum += below[k] * y[node.rows[k]];
+      ys[q] -= sum;
+    }
+    for(uint32_t i = w; i-- > 0;)
+    {
+      const T * d = node.diagonal[i].data();
+      ys[i] /= d[i];
+      for(uint32_t p = 0; p < i; p++)
+        ys[p] -= d[p] * ys[i];
+    }
+  }
+  for(uint32_t k = 0; k < n; k++)
+    bs[f.order[k]] = y[k];
+}
+
+template <typename T>
+void SparseCholeskySolver::factorDiagonal(DenseMatrix<T>& D)
+{
+  uint32_t w = D.getNumRows();
+  for(uint32_t j = 0; j < w; j++)
+  {
+    T * row_j = D[j].data();
+    T d = row_j[j];
+    for(uint32_t p = 0; p < j; p++)
+      d -= row_j[p] * row_j[p];
+    if(!(d > T(0)))
+      throw domain_error("Matrix is not positive definite: SparseCholeskySolver.");
+    row_j[j] = sqrt(d);
+
+    auto column = [&](uint32_t first, uint32_t last)
+    {
+      for(uint32_t i = first; i < last; i++)
+      {
+        T * row_i = D[i].data();
+        T sum = row_i[j];
+        for(uint32_t p = 0; p < j; p++)
+          sum -= row_i[p] * row_j[p];
+        row_i[j] = sum / row_j[j];
+      }
+    };
+    if(w - j > PARALLEL_WIDTH)
+      ThreadPool::shared().parallelFor(j + 1, w, PARALLEL_WIDTH / 4, column);
+    else
+      column(j + 1, w);
+  }
+}
+
+template <typename T>
+void SparseCholeskySolver::solveBelow(const DenseMatrix<T>& D, DenseMatrix<T>& B)
+{
+  uint32_t w = D.getNumRows();
+  uint32_t r = B.getNumColumns();
+  auto columns = [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t j = 0; j < w; j++)
+    {
+      const T * l = D[j].data();
+      T * b_j = B[j].data();
+      for(uint32_t p = 0; p < j; p++)
+      {
+        const T * b_p = B[p].data();
+        for(uint32_t c = first; c < last; c++)
+          b_j[c] -= l[p] * b_p[c];
+      }
+      for(uint32_t c = first; c < last; c++)
+        b_j[c] /= l[j];
+    }
+  };
+  if(uint64_t(w) * w * r < blas::PARALLEL_WORK)
+    columns(0, r);
+  else
+    ThreadPool::shared().parallelFor(0, r, blas::ROW_BLOCK, columns);
+}
+
+template <typename T>
+void SparseCholeskySolver::updateLower(const DenseMatrix<T>& B, DenseMatrix<T>& U)
+{
+  uint32_t w = B.getNumRows();
+  uint32_t r = B.getNumColumns();
+  auto rows = [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t p0 = 0; p0 < w; p0 += blas::DEPTH_BLOCK)
+    {
+      uint32_t p1 = min(w, p0 + blas::DEPTH_BLOCK);
+      for(uint32_t j0 = 0; j0 < last; j0 += blas::ROW_BLOCK)
+      {
+        uint32_t j1 = min(last, j0 + blas::ROW_BLOCK);
+        for(uint32_t i = max(first, j0); i < last; i++)
+        {
+          T * u = U[i].data();
+          uint32_t end = min(j1, i + 1);
+          for(uint32_t p = p0; p < p1; p++)
+          {
+            const T * b = B[p].data();
+            T scale = b[i];
+            for(uint32_t j = j0; j < end; j++)
+              u[j] -= scale * b[j];
+          }
+        }
+      }
+    }
+  };
+  if(uint64_t(r) * r * w / 2 < blas::PARALLEL_WORK)
+    rows(0, r);
+  else
+    ThreadPool::shared().parallelFor(0, r, blas::ROW_BLOCK, rows);
+}
+
+template <typename T, long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double)>
+MathVector<T> SparseCholeskySolver::solveGrid(int32_t n)
+{
+  TraceSpan span("SparseCholeskySolver::solveGrid");
+  if(n < 2)
+    throw domain_error("Grid must have interior points: SparseCholeskySolver.");
+  DirichletSolver<T, SparseCholeskySolver> dirichlet(n);
+  MathVector<T> x;
+  Factors<T> f;
+
+  // Same stencil DirichletSolver::makeOperator assembles, row by row in
+  // column order
+  uint32_t side = n - 1;
+  uint32_t size = side * side;
+  vector<uint32_t> row_start(1, 0);
+  vector<uint32_t> columns;
+  vector<T> values;
+  columns.reserve(5 * size);
+  values.reserve(5 * size);
+  for(uint32_t p = 0; p < size; p++)
+  {
+    uint32_t x_index = p % side;
+    uint32_t y_index = p / side;
+    if(y_index > 0)
+    {
+      columns.push_back(p - side);
+      values.push_back(T(-0.25));
+    }
+    if(x_index > 0)
+    {
+      columns.push_back(p - 1);
+      values.push_back(T(-0.25));
+    }
+    columns.push_back(p);
+    values.push_back(T(1));
+    if(x_index + 1 < side)
+    {
+      columns.push_back(p + 1);
+      values.push_back(T(-0.25));
+    }
+    if(y_index + 1 < side)
+    {
+      columns.push_back(p + side);
+      values.push_back(T(-0.25));
+    }
+    row_start.push_back(columns.size());
+  }
+  SparseMatrix<T> A(size, size, move(row_start), move(columns), move(values));
+
+  dirichlet.template makeVector<fnXL, fnXU, fnYL, fnYU>(x);
+  factor(A, grid_nested_dissection(side, side), f);
+  solve(f, x);
+
+  return x;
+}
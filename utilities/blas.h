@@ -0,0 +1,132 @@
+//////////////////////////////////////////////////////////////////////
+/// @file blas.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the in place, BLAS
+///        style kernels. Each one writes into a destination the caller
+///        owns, so none of them allocate.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void gemm(T alpha, const DenseMatrix<T>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C)
+/// @brief C = alpha * A * B + beta * C.
+/// @pre A is m x k, B is k x n and C is m x n. C is not A or B.
+/// @post C holds the result. When beta is 0, C's old contents are
+///       ignored, even NaNs. Products whose sides are all at least
+///       blas::STRASSEN_THRESHOLD go through strassen_multiply unless
+///       that has been switched off.
+/// @param1 Scale of the product.
+/// @param2 Left factor.
+/// @param3 Right factor.
+/// @param4 Scale of the old C.
+/// @param5 Destination.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void gemm(blas::Transpose trans_a, blas::Transpose trans_b, T alpha, const DenseMatrix<T>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C)
+/// @brief C = alpha * op(A) * op(B) + beta * C, op transposing when its
+///        flag is blas::TRANS. Transposed operands are read in place:
+///        A^T B runs over rows of A and B, A B^T is row by row dot
+///        products and A^T B^T is formed as (B A)^T, a block of C's
+///        rows at a time. Overloads taking TransposedView operands
+///        forward here.
+/// @pre op(A) is m x k, op(B) is k x n and C is m x n. C is not A or B.
+/// @post C holds the result. Large products take the Strassen path as
+///       in the untransposed gemm, which transposes while it copies the
+///       operands in.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void set_strassen_enabled(bool on)
+/// @brief Opt out switch for gemm's automatic use of strassen_multiply
+///        (see strassen.h), for callers that need classical rounding.
+/// @pre None.
+/// @post gemm only uses Strassen when on is true (the default).
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void gemv(T alpha, const DenseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+/// @brief y = alpha * A * x + beta * y.
+/// @pre A is m x n, x has n entries and y has m entries. y is not x.
+/// @post y holds the result.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void gemv(blas::Transpose trans, T alpha, const DenseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+/// @brief y = alpha * op(A) * x + beta * y. A^T x is accumulated as one
+///        axpy per row of A, so A is still read row by row.
+/// @pre op(A) is m x n, x has n entries and y has m entries. y is not x.
+/// @post y holds the result.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void axpy(T alpha, const MathVector<T>& x, MathVector<T>& y)
+/// @brief y = alpha * x + y.
+/// @pre x and y have the same size.
+/// @post y holds the result.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void scal(T alpha, MathVector<T>& x)
+/// @brief x = alpha * x.
+/// @pre None.
+/// @post x holds the result.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef BLAS_H
+#define BLAS_H
+
+#include <atomic>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/transposed_view.h"
+#include "thread_pool.h"
+
+namespace blas
+{
+  // Rows of C per task and depth of the k loop kept hot in cache
+  const uint32_t ROW_BLOCK = 64;
+  const uint32_t DEPTH_BLOCK = 256;
+  // Products with fewer multiply-adds than this stay on the calling thread
+  const uint64_t PARALLEL_WORK = 1 << 21;
+  // gemm switches to Strassen-Winograd when every side is at least this
+  const uint32_t STRASSEN_THRESHOLD = 512;
+
+  enum Transpose { NO_TRANS, TRANS };
+}
+
+void set_strassen_enabled(bool on);
+bool strassen_enabled();
+
+template <typename T>
+void gemm(T alpha, const DenseMatrix<T>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C);
+
+template <typename T>
+void gemm(blas::Transpose trans_a, blas::Transpose trans_b, T alpha, const DenseMatrix<T>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C);
+
+template <typename T>
+void gemm(T alpha, const TransposedView<DenseMatrix<T>>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C);
+
+template <typename T>
+void gemm(T alpha, const DenseMatrix<T>& A, const TransposedView<DenseMatrix<T>>& B, T beta, DenseMatrix<T>& C);
+
+template <typename T>
+void gemm(T alpha, const TransposedView<DenseMatrix<T>>& A, const TransposedView<DenseMatrix<T>>& B, T beta, DenseMatrix<T>& C);
+
+template <typename T>
+void gemv(T alpha, const DenseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y);
+
+template <typename T>
+void gemv(blas::Transpose trans, T alpha, const DenseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y);
+
+template <typename T>
+void gemv(T alpha, const TransposedView<DenseMatrix<T>>& A, const MathVector<T>& x, T beta, MathVector<T>& y);
+
+template <typename T>
+void axpy(T alpha, const MathVector<T>& x, MathVector<T>& y);
+
+template <typename T>
+void scal(T alpha, MathVector<T>& x);
+
+#include "blas.hpp"
+#include "strassen.h"
+
+#endif //BLAS_H
@@ -0,0 +1,261 @@
+//////////////////////////////////////////////////////////////////////
+/// @file blas.hpp
+/// @author Connor McBride
+/// @brief Contains the BLAS style kernel implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef BLAS_HPP
+#define BLAS_HPP
+
+#include <algorithm>
+#include <vector>
+
+namespace blas
+{
+  inline atomic<bool>& strassenFlag()
+  {
+    static atomic<bool> flag(true);
+    return flag;
+  }
+}
+
+inline void set_strassen_enabled(bool on)
+{
+  blas::strassenFlag().store(on);
+}
+
+inline bool strassen_enabled()
+{
+  return blas::strassenFlag().load();
+}
+
+template <typename T>
+void gemm(T alpha, const DenseMatrix<T>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C)
+{
+  gemm(blas::NO_TRANS, blas::NO_TRANS, alpha, A, B, beta, C);
+}
+
+template <typename T>
+void gemm(blas::Transpose trans_a, blas::Transpose trans_b, T alpha, const DenseMatrix<T>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C)
+{
+  bool ta = trans_a == blas::TRANS;
+  bool tb = trans_b == blas::TRANS;
+  uint32_t m = ta ? A.getNumColumns() : A.getNumRows();
+  uint32_t k = ta ? A.getNumRows() : A.getNumColumns();
+  uint32_t n = tb ? B.getNumRows() : B.getNumColumns();
+  if((tb ? B.getNumColumns() : B.getNumRows()) != k || C.getNumRows() != m || C.getNumColumns() != n)
+    throw domain_error("Matrix sizes not compatible: gemm.");
+  if(&C == &A || &C == &B)
+    throw domain_error("Destination aliases a factor: gemm.");
+
+  if(strassen_enabled() && min(m, min(k, n)) >= blas::STRASSEN_THRESHOLD)
+  {
+    if(alpha == T(1) && beta == T(0))
+    {
+      strassen_multiply(A, B, C, ta, tb);
+      return;
+    }
+    DenseMatrix<T> P(m, n);
+    strassen_multiply(A, B, P, ta, tb);
+    for(uint32_t i = 0; i < m; i++)
+    {
+      const T * p = P[i].data();
+      T * c = C[i].data();
+      for(uint32_t j = 0; j < n; j++)
+        c[j] = alpha * p[j] + ((beta == T(0)) ? T(0) : beta * c[j]);
+    }
+    return;
+  }
+
+  auto rows = [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t i = first; i < last; i++)
+    {
+      T * c = C[i].data();
+      for(uint32_t j = 0; j < n; j++)
+        c[j] = (beta == T(0)) ? T(0) : beta * c[j];
+    }
+
+    if(ta && tb)
+    {
+      // Column i of C^T = B A is a sum over rows of A, so a block of C's
+      // rows is accumulated from the matching stretch of each row of A
+      // and written out one column of C at a time. A depth block of A's
+      // rows stays in cache across all the rows of B
+      T sums[blas::ROW_BLOCK];
+      for(uint32_t i0 = first; i0 < last; i0 += blas::ROW_BLOCK)
+      {
+        uint32_t width = min(last, i0 + blas::ROW_BLOCK) - i0;
+        for(uint32_t p0 = 0; p0 < k; p0 += blas::DEPTH_BLOCK)
+        {
+          uint32_t p1 = min(k, p0 + blas::DEPTH_BLOCK);
+          for(uint32_t j = 0; j < n; j++)
+          {
+            const T * b = B[j].data();
+            for(uint32_t i = 0; i < width; i++)
+              sums[i] = 0;
+            for(uint32_t p = p0; p < p1; p++)
+            {
+              T scale = b[p];
+              const T * a = A[p].data() + i0;
+              for(uint32_t i = 0; i < width; i++)
+                sums[i] += scale * a[i];
+            }
+            for(uint32_t i = 0; i < width; i++)
+              C[i0 + i].data()[j] += alpha * sums[i];
+          }
+        }
+      }
+      return;
+    }
+
+    if(tb)
+    {
+      // Row j of B is column j of op(B), so every entry of C is a dot
+      // product. Blocks of B's rows and depth stay in cache across the
+      // rows of C
+      for(uint32_t p0 = 0; p0 < k; p0 += blas::DEPTH_BLOCK)
+      {
+        uint32_t p1 = min(k, p0 + blas::DEPTH_BLOCK);
+        for(uint32_t j0 = 0; j0 < n; j0 += blas::ROW_BLOCK)
+        {
+          uint32_t j1 = min(n, j0 + blas::ROW_BLOCK);
+          for(uint32_t i = first; i < last; i++)
+          {
+            const T * a = A[i].data();
+            T * c = C[i].data();
+            for(uint32_t j = j0; j < j1; j++)
+            {
+              const T * b = B[j].data();
+              T sum = 0;
+              for(uint32_t p = p0; p < p1; p++)
+                sum += a[p] * b[p];
+              c[j] += alpha * sum;
+            }
+          }
+        }
+      }
+      return;
+    }
+
+    // i-k-j order keeps the inner loop on rows of B and C. Row p of a
+    // transposed A holds entry p of every row of op(A)
+    for(uint32_t p0 = 0; p0 < k; p0 += blas::DEPTH_BLOCK)
+    {
+      uint32_t p1 = min(k, p0 + blas::DEPTH_BLOCK);
+      for(uint32_t i = first; i < last; i++)
+      {
+        const T * a = ta ? nullptr : A[i].data();
+        T * c = C[i].data();
+        for(uint32_t p = p0; p < p1; p++)
+        {
+          T scale = alpha * (ta ? A[p].data()[i] : a[p]);
+          const T * b = B[p].data();
+          for(uint32_t j = 0; j < n; j++)
+            c[j] += scale * b[j];
+        }
+      }
+    }
+  };
+
+  if(static_cast<uint64_t>(m) * n * k < blas::PARALLEL_WORK)
+    rows(0, m);
+  else
+    ThreadPool::shared().parallelFor(0, m, blas::ROW_BLOCK, rows);
+}
+
+template <typename T>
+void gemv(T alpha, const DenseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+{
+  uint32_t m = A.getNumRows();
+  uint32_t n = A.getNumColumns();
+  if(x.size() != n || y.size() != m)
+    throw domain_error("Matrix sizes not compatible: gemv.");
+  if(&x == &y)
+    throw domain_error("Destination aliases the source: gemv.");
+
+  const T * xs = x.data();
+  T * ys = y.data();
+  for(uint32_t i = 0; i < m; i++)
+  {
+    const T * a = A[i].data();
+    T sum = 0;
+    for(uint32_t j = 0; j < n; j++)
+      sum += a[j] * xs[j];
+    ys[i] = alpha * sum + ((beta == T(0)) ? T(0) : beta * ys[i]);
+  }
+}
+
+template <typename T>
+void gemv(blas::Transpose trans, T alpha, const DenseMatrix<T>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+{
+  if(trans == blas::NO_TRANS)
+  {
+    gemv(alpha, A, x, beta, y);
+    return;
+  }
+  uint32_t m = A.getNumRows();
+  uint32_t n = A.getNumColumns();
+  if(x.size() != m || y.size() != n)
+    throw domain_error("Matrix sizes not compatible: gemv.");
+  if(&x == &y)
+    throw domain_error("Destination aliases the source: gemv.");
+
+  // A^T x is the sum of x_i times row i of A
+  const T * xs = x.data();
+  T * ys = y.data();
+  for(uint32_t j = 0; j < n; j++)
+    ys[j] = (beta == T(0)) ? T(0) : beta * ys[j];
+  for(uint32_t i = 0; i < m; i++)
+  {
+    const T * a = A[i].data();
+    T scale = alpha * xs[i];
+    for(uint32_t j = 0; j < n; j++)
+      ys[j] += scale * a[j];
+  }
+}
+
+template <typename T>
+void gemv(T alpha, const TransposedView<DenseMatrix<T>>& A, const MathVector<T>& x, T beta, MathVector<T>& y)
+{
+  gemv(blas::TRANS, alpha, A.base(), x, beta, y);
+}
+
+template <typename T>
+void gemm(T alpha, const TransposedView<DenseMatrix<T>>& A, const DenseMatrix<T>& B, T beta, DenseMatrix<T>& C)
+{
+  gemm(blas::TRANS, blas::NO_TRANS, alpha, A.base(), B, beta, C);
+}
+
+template <typename T>
+void gemm(T alpha, const DenseMatrix<T>& A, const TransposedView<DenseMatrix<T>>& B, T beta, DenseMatrix<T>& C)
+{
+  gemm(blas::NO_TRANS, blas::TRANS, alpha, A, B.base(), beta, C);
+}
+
+template <typename T>
+void gemm(T alpha, const TransposedView<DenseMatrix<T>>& A, const TransposedView<DenseMatrix<T>>& B, T beta, DenseMatrix<T>& C)
+{
+  gemm(blas::TRANS, blas::TRANS, alpha, A.base(), B.base(), beta, C);
+}
+
+template <typename T>
+void axpy(T alpha, const MathVector<T>& x, MathVector<T>& y)
+{
+  if(x.size() != y.size())
+    throw domain_error("Sizes not equal: axpy.");
+  const T * xs = x.data();
+  T * ys = y.data();
+  for(uint32_t i = 0; i < y.size(); i++)
+    ys[i] += alpha * xs[i];
+}
+
+template <typename T>
+void scal(T alpha, MathVector<T>& x)
+{
+  T * xs = x.data();
+  for(uint32_t i = 0; i < x.size(); i++)
+    xs[i] *= alpha;
+}
+
+#endif //BLAS_HPP
@@ -0,0 +1,71 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fft.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the FFT class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class FFT
+/// @brief Precomputed plan for complex discrete Fourier transforms of
+///        one length, applied to a batch of sequences at once. Element
+///        j of sequence s lives at index j * batch + s of separate real
+///        and imaginary arrays, so every inner loop runs over the batch
+///        with unit stride and vectorizes. Powers of two use iterative
+///        radix-2; other lengths go through Bluestein's chirp-z
+///        convolution on a power of two.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn FFT(uint32_t length)
+/// @brief Constructor. Builds the twiddle, bit reversal and (when
+///        needed) chirp tables.
+/// @pre length > 0.
+/// @post transform() can be called for sequences of this length.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void transform(T * re, T * im, uint32_t batch, bool inverse) const
+/// @brief In place X_k = sum_j x_j e^(-+2 pi i jk / length), the sign
+///        + for inverse. Neither direction is scaled.
+/// @pre re and im hold length * batch values each.
+/// @post re and im hold the transforms. Safe to call from many threads.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+template <typename T>
+class FFT
+{
+private:
+  uint32_t m_length;
+  // Power of two the work is done in, m_length itself when it is one
+  uint32_t m_size;
+  vector<uint32_t> m_reverse;
+  vector<T> m_cos;
+  vector<T> m_sin;
+  // Bluestein chirp e^(-pi i j^2 / length) and the transformed kernel
+  vector<T> m_chirp_re;
+  vector<T> m_chirp_im;
+  vector<T> m_kernel_re;
+  vector<T> m_kernel_im;
+
+  void radix2(T * re, T * im, uint32_t batch, bool inverse) const;
+
+public:
+  FFT() : m_length(0), m_size(0) {};
+  FFT(uint32_t length);
+
+  uint32_t length() const { return m_length; }
+  void transform(T * re, T * im, uint32_t batch, bool inverse) const;
+};
+
+#include "fft.hpp"
+
+#endif //FFT_H
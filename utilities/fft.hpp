@@ -0,0 +1,168 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fft.hpp
+/// @author Connor McBride
+/// @brief Contains the FFT implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FFT_HPP
+#define FFT_HPP
+
+#include <stdexcept>
+
+template <typename T>
+FFT<T>::FFT(uint32_t length)
+{
+  if(length == 0)
+    throw domain_error("Length must be positive: FFT.");
+  m_length = length;
+
+  // Bluestein needs a circular convolution of at least 2 * length - 1
+  bool power_of_two = (length & (length - 1)) == 0;
+  m_size = 1;
+  while(m_size < (power_of_two ? length : 2 * length - 1))
+    m_size <<= 1;
+
+  uint32_t bits = 0;
+  while((1u << bits) < m_size)
+    bits++;
+  m_reverse.resize(m_size);
+  for(uint32_t i = 0; i < m_size; i++)
+  {
+    uint32_t r = 0;
+    for(uint32_t b = 0; b < bits; b++)
+      r |= ((i >> b) & 1) << (bits - 1 - b);
+    m_reverse[i] = r;
+  }
+  m_cos.resize(m_size / 2 + 1);
+  m_sin.resize(m_size / 2 + 1);
+  for(uint32_t i = 0; i <= m_size / 2; i++)
+  {
+    m_cos[i] = T(cos(2 * M_PI * i / m_size));
+    m_sin[i] = T(sin(2 * M_PI * i / m_size));
+  }
+  if(power_of_two)
+    return;
+
+  // j^2 is taken mod 2 * length so the angle stays small and exact
+  m_chirp_re.resize(length);
+  m_chirp_im.resize(length);
+  for(uint32_t j = 0; j < length; j++)
+  {
+    uint64_t square = (uint64_t(j) * j) % (2 * uint64_t(length));
+    m_chirp_re[j] = T(cos(M_PI * square / length));
+    m_chirp_im[j] = T(-sin(M_PI * square / length));
+  }
+  m_kernel_re.assign(m_size, T(0));
+  m_kernel_im.assign(m_size, T(0));
+  for(uint32_t j = 0; j < length; j++)
+  {
+    m_kernel_re[j] = m_chirp_re[j];
+    m_kernel_im[j] = -m_chirp_im[j];
+    if(j > 0)
+    {
+      m_kernel_re[m_size - j] = m_chirp_re[j];
+      m_kernel_im[m_size - j] = -m_chirp_im[j];
+    }
+  }
+  radix2(m_kernel_re.data(), m_kernel_im.data(), 1, false);
+}
+
+template <typename T>
+void FFT<T>::radix2(T * re, T * im, uint32_t batch, bool inverse) const
+{
+  for(uint32_t i = 0; i < m_size; i++)
+  {
+    uint32_t j = m_reverse[i];
+    if(i < j)
+      for(uint32_t s = 0; s < batch; s++)
+      {
+        swap(re[i * batch + s], re[j * batch + s]);
+        swap(im[i * batch + s], im[j * batch + s]);
+      }
+  }
+
+  for(uint32_t len = 2; len <= m_size; len <<= 1)
+  {
+    uint32_t half = len / 2;
+    uint32_t step = m_size / len;
+    for(uint32_t start = 0; start < m_size; start += len)
+      for(uint32_t j = 0; j < half; j++)
+      {
+        T wr = m_cos[j * step];
+        T wi = inverse ? m_sin[j * step] : -m_sin[j * step];
+        T * ar = re + (start + j) * batch;
+        T * ai = im + (start + j) * batch;
+        T * br = ar + half * batch;
+        T * bi = ai + half * batch;
+        for(uint32_t s = 0; s < batch; s++)
+        {
+          T tr = br[s] * wr - bi[s] * wi;
+          T ti = br[s] * wi + bi[s] * wr;
+          br[s] = ar[s] - tr;
+          bi[s] = ai[s] - ti;
+          ar[s] += tr;
+          ai[s] += ti;
+        }
+      }
+  }
+}
+
+template <typename T>
+void FFT<T>::transform(T * re, T * im, uint32_t batch, bool inverse) const
+{
+  if(m_size == m_length)
+  {
+    radix2(re, im, batch, inverse);
+    return;
+  }
+
+  // Bluestein: X_k = w_k sum_j (x_j w_j) conj(w_(k-j)), the sum being a
+  // convolution done with two power of two transforms. The inverse is
+  // the forward transform of the conjugate, conjugated.
+  T sign = inverse ? T(-1) : T(1);
+  vector<T> ar(m_size * batch, T(0));
+  vector<T> ai(m_size * batch, T(0));
+  for(uint32_t j = 0; j < m_length; j++)
+  {
+    T cr = m_chirp_re[j];
+    T ci = m_chirp_im[j];
+    for(uint32_t s = 0; s < batch; s++)
+    {
+      T xr = re[j * batch + s];
+      T xi = sign * im[j * batch + s];
+      ar[j * batch + s] = xr * cr - xi * ci;
+      ai[j * batch + s] = xr * ci + xi * cr;
+    }
+  }
+
+  radix2(ar.data(), ai.data(), batch, false);
+  for(uint32_t j = 0; j < m_size; j++)
+  {
+    T kr = m_kernel_re[j];
+    T ki = m_kernel_im[j];
+    for(uint32_t s = 0; s < batch; s++)
+    {
+      T xr = ar[j * batch + s];
+      T xi = ai[j * batch + s];
+      ar[j * batch + s] = xr * kr - xi * ki;
+      ai[j * batch + s] = xr * ki + xi * kr;
+    }
+  }
+  radix2(ar.data(), ai.data(), batch, true);
+
+  T scale = T(1) / m_size;
+  for(uint32_t j = 0; j < m_length; j++)
+  {
+    T cr = m_chirp_re[j] * scale;
+    T ci = m_chirp_im[j] * scale;
+    for(uint32_t s = 0; s < batch; s++)
+    {
+      T xr = ar[j * batch + s];
+      T xi = ai[j * batch + s];
+      re[j * batch + s] = xr * cr - xi * ci;
+      im[j * batch + s] = sign * (xr * ci + xi * cr);
+    }
+  }
+}
+
+#endif //FFT_HPP
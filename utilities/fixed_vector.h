@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fixed_vector.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the FixedVector class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class FixedVector
+/// @brief Vector whose size N is known at compile time. Elements live in
+///        a std::array inside the object, so it never allocates, and every
+///        operation is unrolled and usable in constant expressions.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn constexpr FixedVector()
+/// @brief Explicit definition of the default constructor.
+/// @pre None.
+/// @post A FixedVector with all N elements set to 0.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn constexpr FixedVector(initializer_list<T> elements)
+/// @brief Overload of constructor which takes the elements in order.
+/// @pre elements has at most N entries.
+/// @post Elements past the end of the list are 0.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn explicit FixedVector(const MathVector<T>& other)
+/// @brief Overload of constructor which copies a MathVector.
+/// @pre other.size() == N.
+/// @post A FixedVector holding the elements of other.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> toMathVector() const
+/// @brief Copies the called object into a MathVector for the dynamic solvers.
+/// @pre None.
+/// @return Returns a MathVector of size N.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T magnitude() const
+/// @brief Euclidean length of the called object.
+/// @pre None.
+/// @return Returns the square root of the sum of squares.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FIXED_VECTOR_H
+#define FIXED_VECTOR_H
+
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include "math_vector.h"
+#include "unroll.h"
+
+template <typename T, uint32_t N>
+class FixedVector
+{
+private:
+  array<T, N> m_elements;
+
+public:
+  // Constructors
+  constexpr FixedVector() : m_elements{} {}
+  constexpr FixedVector(initializer_list<T> elements);
+  explicit FixedVector(const MathVector<T>& other);
+
+  // Getters
+  constexpr uint32_t size() const { return N; }
+  T * data() { return m_elements.data(); }
+  const T * data() const { return m_elements.data(); }
+  MathVector<T> toMathVector() const;
+
+  // Functions
+  T magnitude() const;
+
+  // Operators
+  constexpr T& operator [](uint32_t index) { return m_elements[index]; }
+  constexpr const T& operator [](uint32_t index) const { return m_elements[index]; }
+  constexpr FixedVector& operator +=(const FixedVector& rhs);
+  constexpr FixedVector& operator -=(const FixedVector& rhs);
+  constexpr FixedVector& operator *=(T c);
+};
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N> operator +(FixedVector<T, N> lhs, const FixedVector<T, N>& rhs);
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N> operator -(FixedVector<T, N> lhs, const FixedVector<T, N>& rhs);
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N> operator *(T c, FixedVector<T, N> rhs);
+
+template <typename T, uint32_t N>
+constexpr T operator *(const FixedVector<T, N>& lhs, const FixedVector<T, N>& rhs);
+
+template <typename T, uint32_t N>
+ostream& operator <<(ostream& out, const FixedVector<T, N>& rhs);
+
+#include "fixed_vector.hpp"
+
+#endif //FIXED_VECTOR_H
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////
+/// @file fixed_vector.hpp
+/// @author Connor McBride
+/// @brief Contains the FixedVector class implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef FIXED_VECTOR_HPP
+#define FIXED_VECTOR_HPP
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N>::FixedVector(initializer_list<T> elements) : m_elements{}
+{
+  uint32_t i = 0;
+  for(const T& element : elements)
+    m_elements[i++] = element;
+}
+
+template <typename T, uint32_t N>
+FixedVector<T, N>::FixedVector(const MathVector<T>& other) : m_elements{}
+{
+  if(other.size() != N)
+    throw domain_error("Sizes not equal: FixedVector.");
+  unroll<0, N>([&](auto i) { m_elements[i] = other.data()[i]; });
+}
+
+template <typename T, uint32_t N>
+MathVector<T> FixedVector<T, N>::toMathVector() const
+{
+  MathVector<T> ret(N);
+  for(uint32_t i = 0; i < N; i++)
+    ret.push(m_elements[i]);
+  return ret;
+}
+
+template <typename T, uint32_t N>
+T FixedVector<T, N>::magnitude() const
+{
+  return sqrt((*this) * (*this));
+}
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N>& FixedVector<T, N>::operator +=(const FixedVector<T, N>& rhs)
+{
+  unroll<0, N>([&](auto i) { m_elements[i] += rhs[i]; });
+  return *this;
+}
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N>& FixedVector<T, N>::operator -=(const FixedVector<T, N>& rhs)
+{
+  unroll<0, N>([&](auto i) { m_elements[i] -= rhs[i]; });
+  return *this;
+}
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N>& FixedVector<T, N>::operator *=(T c)
+{
+  unroll<0, N>([&](auto i) { m_elements[i] *= c; });
+  return *this;
+}
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N> operator +(FixedVector<T, N> lhs, const FixedVector<T, N>& rhs)
+{
+  return lhs += rhs;
+}
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N> operator -(FixedVector<T, N> lhs, const FixedVector<T, N>& rhs)
+{
+  return lhs -= rhs;
+}
+
+template <typename T, uint32_t N>
+constexpr FixedVector<T, N> operator *(T c, FixedVector<T, N> rhs)
+{
+  return rhs *= c;
+}
+
+template <typename T, uint32_t N>
+constexpr T operator *(const FixedVector<T, N>& lhs, const FixedVector<T, N>& rhs)
+{
+  T ret = 0;
+  unroll<0, N>([&](auto i) { ret += lhs[i] * rhs[i]; });
+  return ret;
+}
+
+template <typename T, uint32_t N>
+ostream& operator <<(ostream& out, const FixedVector<T, N>& rhs)
+{
+  for(uint32_t i = 0; i < N; i++)
+    out << rhs[i] << (i + 1 == N ? "" : ", ");
+  return out;
+}
+
+#endif //FIXED_VECTOR_HPP
@@ -0,0 +1,41 @@
+//////////////////////////////////////////////////////////////////////
+/// @file grid_ordering.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the fill reducing
+///        orderings of grid operators
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn vector<uint32_t> grid_nested_dissection(uint32_t width, uint32_t height)
+/// @brief Geometric nested dissection of a width x height grid whose
+///        point (x, y) is unknown y * width + x, the numbering
+///        DirichletSolver::pointIndex uses. A grid line through the
+///        middle of the longer side splits the points in two; both
+///        halves are ordered first, recursively, and the line last.
+///        For a 5-point operator Cholesky then fills O(N log N) entries
+///        and takes O(N^1.5) flops instead of O(N^2) and O(N^3) dense.
+/// @pre None.
+/// @post None.
+/// @return Returns order, where order[k] is the unknown eliminated k-th.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef GRID_ORDERING_H
+#define GRID_ORDERING_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+namespace grid_ordering
+{
+  // Pieces with at most this many points are not split any further
+  const uint32_t LEAF_POINTS = 16;
+}
+
+vector<uint32_t> grid_nested_dissection(uint32_t width, uint32_t height);
+
+#include "grid_ordering.hpp"
+
+#endif //GRID_ORDERING_H
@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////
+/// @file grid_ordering.hpp
+/// @author Connor McBride
+/// @brief Contains the grid ordering implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef GRID_ORDERING_HPP
+#define GRID_ORDERING_HPP
+
+namespace grid_ordering
+{
+  // Appends the points of [x0, x1) x [y0, y1) to order
+  inline void dissect(uint32_t width, uint32_t x0, uint32_t x1, uint32_t y0, uint32_t y1, vector<uint32_t>& order)
+  {
+    uint32_t w = x1 - x0;
+    uint32_t h = y1 - y0;
+    if(w * h <= LEAF_POINTS || max(w, h) < 3)
+    {
+      for(uint32_t y = y0; y < y1; y++)
+        for(uint32_t x = x0; x < x1; x++)
+          order.push_back(y * width + x);
+      return;
+    }
+
+    if(w >= h)
+    {
+      uint32_t middle = x0 + w / 2;
+      dissect(width, x0, middle, y0, y1, order);
+      dissect(width, middle + 1, x1, y0, y1, order);
+      for(uint32_t y = y0; y < y1; y++)
+        order.push_back(y * width + middle);
+    }
+    else
+    {
+      uint32_t middle = y0 + h / 2;
+      dissect(width, x0, x1, y0, middle, order);
+      dissect(width, x0, x1, middle + 1, y1, order);
+      for(uint32_t x = x0; x < x1; x++)
+        order.push_back(middle * width + x);
+    }
+  }
+}
+
+inline vector<uint32_t> grid_nested_dissection(uint32_t width, uint32_t height)
+{
+  vector<uint32_t> order;
+  order.reserve(size_t(width) * height);
+  if(width > 0 && height > 0)
+    grid_ordering::dissect(width, 0, width, 0, height, order);
+  return order;
+}
+
+#endif //GRID_ORDERING_HPP
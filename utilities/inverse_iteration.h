@@ -0,0 +1,98 @@
+//////////////////////////////////////////////////////////////////////
+/// @file inverse_iteration.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the InverseIteration class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class InverseIteration
+/// @brief Eigenvectors for eigenvalues that are already roughly known,
+///        such as the diagonal QRDecomp leaves behind. A - shift I is
+///        factored once by SOLVER and every step after that is one
+///        O(n^2) solve with the stored factors.
+/// @pre SOLVER must provide Factors<T>, factor() and solve() like
+///      GaussianSolver and QRSolver do.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn InverseIteration(double tolerance, uint32_t max_iterations)
+/// @brief Constructor.
+/// @pre None.
+/// @post A pair counts as converged once |Ax - lambda x| is at most
+///       tolerance * |A| for unit x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factor(const DenseMatrix<T>& A, T shift)
+/// @brief Factors A - shift I and keeps A for residuals.
+/// @pre A is square.
+/// @post operator() iterates with these factors until factor() is
+///       called again. A shift exactly on an eigenvalue is nudged off it.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T operator ()(MathVector<T>& x)
+/// @brief Shift and invert iteration from x with the stored factors.
+///        Converges linearly, faster the closer the shift is.
+/// @pre factor() has been called and x has n nonzero entries.
+/// @post x is the unit eigenvector for the eigenvalue nearest the shift.
+/// @return Returns that eigenvalue as the Rayleigh quotient of x.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn T rayleigh(const DenseMatrix<T>& A, T target, MathVector<T>& x)
+/// @brief Rayleigh quotient iteration. A few steps with the factors at
+///        target lock onto the eigenvector nearest it, then each step
+///        refactors at the current Rayleigh quotient. Cubic convergence
+///        for symmetric A, quadratic otherwise.
+/// @pre A is square and x has n nonzero entries.
+/// @post x is the unit eigenvector, the factors are those of the last
+///       shift used.
+/// @return Returns the eigenvalue.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef INVERSE_ITERATION_H
+#define INVERSE_ITERATION_H
+
+#include <cmath>
+#include "../matrices/dense_matrix.h"
+#include "../solvers/gaussian_solver.h"
+#include "blas.h"
+#include "trace.h"
+
+template <typename T, class SOLVER = GaussianSolver>
+class InverseIteration
+{
+private:
+  double m_tolerance;
+  uint32_t m_max_iterations;
+  uint32_t m_iterations;
+  uint32_t m_factorizations;
+  T m_residual;
+  T m_norm_a;
+  T m_shift;
+  DenseMatrix<T> m_a;
+  DenseMatrix<T> m_shifted;
+  SOLVER m_solver;
+  typename SOLVER::template Factors<T> m_factors;
+
+  T residual(const MathVector<T>& x, T lambda, MathVector<T>& ax) const;
+  bool step(MathVector<T>& x);
+
+public:
+  InverseIteration(double tolerance = 1e-12, uint32_t max_iterations = 200)
+    : m_tolerance(tolerance), m_max_iterations(max_iterations), m_iterations(0),
+      m_factorizations(0), m_residual(0), m_norm_a(0), m_shift(0) {};
+
+  void factor(const DenseMatrix<T>& A, T shift);
+  T operator()(MathVector<T>& x);
+  T rayleigh(const DenseMatrix<T>& A, T target, MathVector<T>& x);
+
+  uint32_t iterations() const { return m_iterations; }
+  uint32_t factorizations() const { return m_factorizations; }
+  T residualNorm() const { return m_residual; }
+};
+
+#include "inverse_iteration.hpp"
+
+#endif //INVERSE_ITERATION_H
@@ -0,0 +1,157 @@
+//////////////////////////////////////////////////////////////////////
+/// @file inverse_iteration.hpp
+/// @author Connor McBride
+/// @brief Contains the InverseIteration implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef INVERSE_ITERATION_HPP
+#define INVERSE_ITERATION_HPP
+
+#include <limits>
+
+template <typename T, class SOLVER>
+void InverseIteration<T, SOLVER>::factor(const DenseMatrix<T>& A, T shift)
+{
+  TraceSpan span("InverseIteration::factor");
+  uint32_t n = A.getNumRows();
+  if(A.getNumColumns() != n)
+    throw domain_error("Matrix must be square: InverseIteration.");
+
+  // Reuse the storage of an earlier matrix of the same size
+  if(m_a.getNumRows() == n && m_a.getNumColumns() == n)
+  {
+    if(&A != &m_a)
+      for(uint32_t i = 0; i < n; i++)
+        copy(A[i].data(), A[i].data() + n, m_a[i].data());
+  }
+  else
+    m_a = A;
+  if(m_shifted.getNumRows() != n || m_shifted.getNumColumns() != n)
+    m_shifted = DenseMatrix<T>(n, n);
+
+  m_norm_a = 0;
+  for(uint32_t i = 0; i < n; i++)
+  {
+    const T * row = m_a[i].data();
+    T sum = 0;
+    for(uint32_t j = 0; j < n; j++)
+      sum += fabs(row[j]);
+    m_norm_a = max(m_norm_a, sum);
+  }
+
+  for(uint32_t i = 0; i < n; i++)
+  {
+    copy(m_a[i].data(), m_a[i].data() + n, m_shifted[i].data());
+    m_shifted[i].data()[i] -= shift;
+  }
+  // Solvers that reject a singular A - shift I get the shift moved off
+  // the eigenvalue here rather than in step()
+  try
+  {
+    m_solver.factor(m_shifted, m_factors);
+  }
+  catch(const domain_error&)
+  {
+    T nudge = 1000 * numeric_limits<T>::epsilon() * max(m_norm_a, T(1));
+    for(uint32_t i = 0; i < n; i++)
+      m_shifted[i].data()[i] -= nudge;
+    shift += nudge;
+    m_solver.factor(m_shifted, m_factors);
+  }
+  m_shift = shift;
+  m_factorizations++;
+}
+
+template <typename T, class SOLVER>
+T InverseIteration<T, SOLVER>::residual(const MathVector<T>& x, T lambda, MathVector<T>& ax) const
+{
+  const T * xs = x.data();
+  const T * ys = ax.data();
+  T sum = 0;
+  for(uint32_t i = 0; i < x.size(); i++)
+    sum += (ys[i] - lambda * xs[i]) * (ys[i] - lambda * xs[i]);
+  return sqrt(sum);
+}
+
+template <typename T, class SOLVER>
+bool InverseIteration<T, SOLVER>::step(MathVector<T>& x)
+{
+  TraceSpan span("InverseIteration::step");
+  uint32_t n = x.size();
+  MathVector<T> y = x;
+  m_solver.solve(m_factors, y);
+  T length = sqrt(y * y);
+
+  // A shift sitting exactly on an eigenvalue leaves A - shift I
+  // singular; move it off by a few ulps of |A| and solve again
+  if(!isfinite(length) || length == T(0))
+  {
+    factor(m_a, m_shift + 1000 * numeric_limits<T>::epsilon() * max(m_norm_a, T(1)));
+    y = x;
+    m_solver.solve(m_factors, y);
+    length = sqrt(y * y);
+    if(!isfinite(length) || length == T(0))
+      return false;
+  }
+
+  copy(y.data(), y.data() + n, x.data());
+  scal(T(1) / length, x);
+  return true;
+}
+
+template <typename T, class SOLVER>
+T InverseIteration<T, SOLVER>::operator()(MathVector<T>& x)
+{
+  if(x.size() != m_a.getNumRows())
+    throw domain_error("Vector size not compatible: InverseIteration.");
+  MathVector<T> ax = x;
+  T lambda = m_shift;
+
+  scal(T(1) / sqrt(x * x), x);
+  for(m_iterations = 0; m_iterations < m_max_iterations; )
+  {
+    if(!step(x))
+      throw domain_error("Shifted matrix is singular: InverseIteration.");
+    m_iterations++;
+
+    gemv(T(1), m_a, x, T(0), ax);
+    lambda = x * ax;
+    m_residual = residual(x, lambda, ax);
+    if(m_residual <= m_tolerance * m_norm_a)
+      break;
+  }
+  return lambda;
+}
+
+template <typename T, class SOLVER>
+T InverseIteration<T, SOLVER>::rayleigh(const DenseMatrix<T>& A, T target, MathVector<T>& x)
+{
+  TraceSpan span("InverseIteration::rayleigh");
+  const uint32_t LOCK_STEPS = 2;
+  if(x.size() != A.getNumRows())
+    throw domain_error("Vector size not compatible: InverseIteration.");
+  MathVector<T> ax = x;
+  T lambda = target;
+
+  // Steps at the fixed target first, so the Rayleigh quotient starts
+  // near the eigenvalue closest to target instead of wandering off
+  factor(A, target);
+  scal(T(1) / sqrt(x * x), x);
+  for(m_iterations = 0; m_iterations < m_max_iterations; )
+  {
+    if(m_iterations >= LOCK_STEPS)
+      factor(m_a, lambda);
+    if(!step(x))
+      throw domain_error("Shifted matrix is singular: InverseIteration.");
+    m_iterations++;
+
+    gemv(T(1), m_a, x, T(0), ax);
+    lambda = x * ax;
+    m_residual = residual(x, lambda, ax);
+    if(m_residual <= m_tolerance * m_norm_a)
+      break;
+  }
+  return lambda;
+}
+
+#endif //INVERSE_ITERATION_HPP
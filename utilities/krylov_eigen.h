@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////
+/// @file krylov_eigen.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the
+///        LanczosEigensolver and ArnoldiEigensolver classes
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class LanczosEigensolver
+/// @brief Implicitly restarted Lanczos for a few eigenpairs of a large
+///        symmetric matrix. The basis is fully reorthogonalized, the
+///        restart applies the unwanted Ritz values as exact shifts to
+///        the small tridiagonal matrix, and A is only touched through
+///        gemv, so dense, sparse and matrix-free operators all work.
+/// @pre A is symmetric.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class ArnoldiEigensolver
+/// @brief Implicitly restarted Arnoldi for a few eigenpairs of a large
+///        general matrix. Same scheme as LanczosEigensolver with a full
+///        Hessenberg projection; complex conjugate shifts are applied
+///        together as one real double shift so the basis stays real.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn LanczosEigensolver(uint32_t basis_size, double tolerance, uint32_t max_restarts)
+/// @brief Constructor. ArnoldiEigensolver takes the same arguments.
+/// @pre None.
+/// @post The basis holds basis_size vectors (0 picks max(2k + 1, 20)),
+///       and a Ritz pair counts as converged once its residual is below
+///       tolerance * |eigenvalue|.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void operator ()(const MATRIX& A, uint32_t k, EigenTarget target, MathVector<T>& values, DenseMatrix<T>& vectors)
+/// @brief Finds the k eigenvalues of A at the end of the spectrum named
+///        by target, with their eigenvectors.
+/// @pre gemv(alpha, A, x, beta, y) is defined for MATRIX, A is square
+///      and 0 < k < rows of A.
+/// @post values holds the eigenvalues in target order and row i of
+///       vectors the unit eigenvector for values[i]. converged() tells
+///       how many pairs met the tolerance within max_restarts. The
+///       Arnoldi version fills complex values and vectors.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef KRYLOV_EIGEN_H
+#define KRYLOV_EIGEN_H
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <random>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/sparse_matrix.h"
+#include "blas.h"
+#include "trace.h"
+
+enum EigenTarget
+{
+  LARGEST_MAGNITUDE,
+  SMALLEST_MAGNITUDE,
+  LARGEST_REAL,
+  SMALLEST_REAL
+};
+
+// Pieces shared by both solvers. Small matrices are m x m row major
+// vectors. V is the Krylov basis, H its projection and f the residual,
+// so A V = V H + f e_m^T.
+namespace krylov
+{
+  template <typename T>
+  void randomVector(const vector<MathVector<T>>& V, uint32_t count, MathVector<T>& v, mt19937& generator);
+  template <typename T>
+  void orthogonalize(const vector<MathVector<T>>& V, uint32_t count, MathVector<T>& w, vector<T>& h);
+  template <typename T, class MATRIX>
+  void extend(const MATRIX& A, vector<MathVector<T>>& V, MathVector<T>& f, vector<T>& H,
+              uint32_t m, uint32_t from, mt19937& generator);
+  template <typename T>
+  void shift(vector<T>& H, vector<T> M, vector<T>& Q, uint32_t m);
+  template <typename T>
+  void compress(vector<MathVector<T>>& V, MathVector<T>& f, vector<T>& H, const vector<T>& Q,
+                uint32_t m, uint32_t k);
+  template <typename T>
+  void tridiagonalEigen(vector<T>& d, vector<T> e, vector<T>& Z, uint32_t m);
+  template <typename T>
+  vector<complex<T>> hessenbergEigenvalues(const vector<T>& H, uint32_t m);
+  template <typename T>
+  vector<complex<T>> nullVector(const vector<T>& H, uint32_t m, complex<T> theta);
+  template <typename S>
+  vector<uint32_t> order(const vector<S>& values, EigenTarget target);
+}
+
+class LanczosEigensolver
+{
+private:
+  uint32_t m_basis_size;
+  double m_tolerance;
+  uint32_t m_max_restarts;
+  uint32_t m_restarts;
+  uint32_t m_converged;
+
+public:
+  LanczosEigensolver(uint32_t basis_size = 0, double tolerance = 1e-10, uint32_t max_restarts = 1000)
+    : m_basis_size(basis_size), m_tolerance(tolerance), m_max_restarts(max_restarts),
+      m_restarts(0), m_converged(0) {};
+
+  template <typename T, class MATRIX>
+  void operator()(const MATRIX& A, uint32_t k, EigenTarget target, MathVector<T>& values, DenseMatrix<T>& vectors);
+
+  uint32_t restarts() const { return m_restarts; }
+  uint32_t converged() const { return m_converged; }
+};
+
+class ArnoldiEigensolver
+{
+private:
+  uint32_t m_basis_size;
+  double m_tolerance;
+  uint32_t m_max_restarts;
+  uint32_t m_restarts;
+  uint32_t m_converged;
+
+public:
+  ArnoldiEigensolver(uint32_t basis_size = 0, double tolerance = 1e-10, uint32_t max_restarts = 1000)
+    : m_basis_size(basis_size), m_tolerance(tolerance), m_max_restarts(max_restarts),
+      m_restarts(0), m_converged(0) {};
+
+  template <typename T, class MATRIX>
+  void operator()(const MATRIX& A, uint32_t k, EigenTarget target,
+                  MathVector<complex<T>>& values, DenseMatrix<complex<T>>& vectors);
+
+  uint32_t restarts() const { return m_restarts; }
+  uint32_t converged() const { return m_converged; }
+};
+
+#include "krylov_eigen.hpp"
+
+#endif //KRYLOV_EIGEN_H
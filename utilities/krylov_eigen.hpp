@@ -0,0 +1,603 @@
+//////////////////////////////////////////////////////////////////////
+/// @file krylov_eigen.hpp
+/// @author Connor McBride
+/// @brief Contains the LanczosEigensolver and ArnoldiEigensolver
+///        implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef KRYLOV_EIGEN_HPP
+#define KRYLOV_EIGEN_HPP
+
+namespace krylov
+{
+  template <typename T>
+  void randomVector(const vector<MathVector<T>>& V, uint32_t count, MathVector<T>& v, mt19937& generator)
+  {
+    uniform_real_distribution<double> uniform(-1, 1);
+    vector<T> h;
+    T * vs = v.data();
+    for(uint32_t i = 0; i < v.size(); i++)
+      vs[i] = T(uniform(generator));
+    orthogonalize(V, count, v, h);
+    scal(T(1) / sqrt(v * v), v);
+  }
+
+  template <typename T>
+  void orthogonalize(const vector<MathVector<T>>& V, uint32_t count, MathVector<T>& w, vector<T>& h)
+  {
+    // Modified Gram-Schmidt, twice, which is enough to keep the basis
+    // orthogonal to working precision
+    h.assign(count, T(0));
+    for(uint32_t pass = 0; pass < 2; pass++)
+      for(uint32_t i = 0; i < count; i++)
+      {
+        T c = w * V[i];
+        axpy(-c, V[i], w);
+        h[i] += c;
+      }
+  }
+
+  template <typename T, class MATRIX>
+  void extend(const MATRIX& A, vector<MathVector<T>>& V, MathVector<T>& f, vector<T>& H,
+              uint32_t m, uint32_t from, mt19937& generator)
+  {
+    uint32_t n = f.size();
+    vector<T> h;
+
+    for(uint32_t j = from; j < m; j++)
+    {
+      if(j > 0)
+      {
+        // A zero residual means the basis spans an invariant subspace;
+        // carry on with a fresh direction and a zero coupling
+        T beta = sqrt(f * f);
+        if(beta == T(0))
+          randomVector(V, j, V[j], generator);
+        else
+        {
+          copy(f.data(), f.data() + n, V[j].data());
+          scal(T(1) / beta, V[j]);
+        }
+        H[j * m + j - 1] = beta;
+      }
+
+      gemv(T(1), A, V[j], T(0), f);
+      T norm_av = sqrt(f * f);
+      orthogonalize(V, j + 1, f, h);
+      for(uint32_t i = 0; i <= j; i++)
+        H[i * m + j] = h[i];
+      if(sqrt(f * f) <= 10 * numeric_limits<T>::epsilon() * norm_av)
+        fill(f.data(), f.data() + n, T(0));
+    }
+  }
+
+  template <typename T>
+  void shift(vector<T>& H, vector<T> M, vector<T>& Q, uint32_t m)
+  {
+    // Householder QR of the shift polynomial M. Each reflector P is
+    // applied as H = P H P and Q = Q P right away instead of forming
+    // the orthogonal factor.
+    vector<T> v(m);
+    for(uint32_t j = 0; j + 1 < m; j++)
+    {
+      T norm = 0;
+      for(uint32_t i = j; i < m; i++)
+        norm += M[i * m + j] * M[i * m + j];
+      norm = sqrt(norm);
+      if(norm == T(0))
+        continue;
+
+      T alpha = M[j * m + j] > T(0) ? -norm : norm;
+      T vtv = 0;
+      for(uint32_t i = j; i < m; i++)
+      {
+        v[i] = M[i * m + j] - (i == j ? alpha : T(0));
+        vtv += v[i] * v[i];
+      }
+      if(vtv == T(0))
+        continue;
+      T scale = T(2) / vtv;
+
+      auto left = [&](vector<T>& X, uint32_t first_column)
+      {
+        for(uint32_t c = first_column; c < m; c++)
+        {
+          T s = 0;
+          for(uint32_t i = j; i < m; i++)
+            s += v[i] * X[i * m + c];
+          s *= scale;
+          for(uint32_t i = j; i < m; i++)
+            X[i * m + c] -= s * v[i];
+        }
+      };
+      auto right = [&](vector<T>& X)
+      {
+        for(uint32_t r = 0; r < m; r++)
+        {
+          T s = 0;
+          for(uint32_t i = j; i < m; i++)
+            s += X[r * m + i] * v[i];
+          s *= scale;
+          for(uint32_t i = j; i < m; i++)
+            X[r * m + i] -= s * v[i];
+        }
+      };
+      left(M, j);
+      left(H, 0);
+      right(H);
+      right(Q);
+    }
+
+    // Exactly Hessenberg again
+    for(uint32_t i = 2; i < m; i++)
+      for(uint32_t j = 0; j + 1 < i; j++)
+        H[i * m + j] = 0;
+  }
+
+  template <typename T>
+  void compress(vector<MathVector<T>>& V, MathVector<T>& f, vector<T>& H, const vector<T>& Q,
+                uint32_t m, uint32_t k)
+  {
+    // V Q keeps its first k columns as the new basis; column k and the
+    // old residual make the new residual
+    uint32_t n = f.size();
+    T coupling = H[k * m + k - 1];
+    T weight = Q[(m - 1) * m + k - 1];
+    ThreadPool::shared().parallelFor(0, n, 1024, [&](uint32_t first, uint32_t last)
+    {
+      vector<T> row(k + 1);
+      for(uint32_t r = first; r < last; r++)
+      {
+        fill(row.begin(), row.end(), T(0));
+        for(uint32_t i = 0; i < m; i++)
+        {
+          T x = V[i].data()[r];
+          for(uint32_t j = 0; j <= k; j++)
+            row[j] += x * Q[i * m + j];
+        }
+        for(uint32_t j = 0; j < k; j++)
+          V[j].data()[r] = row[j];
+        f.data()[r] = row[k] * coupling + f.data()[r] * weight;
+      }
+    });
+
+    for(uint32_t i = 0; i < m; i++)
+      for(uint32_t j = 0; j < m; j++)
+        if(i >= k || j >= k)
+          H[i * m + j] = 0;
+  }
+
+  template <typename T>
+  void tridiagonalEigen(vector<T>& d, vector<T> e, vector<T>& Z, uint32_t m)
+  {
+    // Implicit QL with Wilkinson shifts. d is the diagonal, e[i] couples
+    // i and i + 1. On return d holds the eigenvalues and column i of Z
+    // the eigenvector for d[i].
+    const T eps = numeric_limits<T>::epsilon();
+    Z.assign(m * m, T(0));
+    for(uint32_t i = 0; i < m; i++)
+      Z[i * m + i] = 1;
+    e.resize(m);
+    e[m - 1] = 0;
+
+    for(int32_t l = 0; l < int32_t(m); l++)
+    {
+      uint32_t iterations = 0;
+      int32_t mm;
+      do
+      {
+        for(mm = l; mm < int32_t(m) - 1; mm++)
+          if(fabs(e[mm]) <= eps * (fabs(d[mm]) + fabs(d[mm + 1])))
+            break;
+        if(mm == l)
+          break;
+        if(iterations++ == 60)
+          throw domain_error("Tridiagonal QL did not converge: krylov.");
+
+        T g = (d[l + 1] - d[l]) / (2 * e[l]);
+        T r = hypot(g, T(1));
+        g = d[mm] - d[l] + e[l] / (g + copysign(r, g));
+        T s = 1;
+        T c = 1;
+        T p = 0;
+        int32_t i;
+        for(i = mm - 1; i >= l; i--)
+        {
+          T f = s * e[i];
+          T b = c * e[i];
+          r = hypot(f, g);
+          e[i + 1] = r;
+          if(r == T(0))
+          {
+            d[i + 1] -= p;
+            e[mm] = 0;
+            break;
+          }
+          s = f / r;
+          c = g / r;
+          g = d[i + 1] - p;
+          r = (d[i] - g) * s + 2 * c * b;
+          p = s * r;
+          d[i + 1] = g + p;
+          g = c * r - b;
+          for(uint32_t k = 0; k < m; k++)
+          {
+            T z = Z[k * m + i + 1];
+            Z[k * m + i + 1] = s * Z[k * m + i] + c * z;
+            Z[k * m + i] = c * Z[k * m + i] - s * z;
+          }
+        }
+        if(r == T(0) && i >= l)
+          continue;
+        d[l] -= p;
+        e[l] = g;
+        e[mm] = 0;
+      } while(true);
+    }
+  }
+
+  template <typename T>
+  vector<complex<T>> hessenbergEigenvalues(const vector<T>& H, uint32_t m)
+  {
+    // Single shift QR in complex arithmetic with Wilkinson shifts,
+    // deflating from the bottom. Eigenvalues only.
+    const T eps = numeric_limits<T>::epsilon();
+    vector<complex<T>> A(H.begin(), H.end());
+    vector<complex<T>> values(m);
+    vector<T> cs(m);
+    vector<complex<T>> sn(m);
+    auto a = [&](uint32_t i, uint32_t j) -> complex<T>& { return A[i * m + j]; };
+
+    int32_t hi = m - 1;
+    uint32_t iterations = 0;
+    while(hi >= 0)
+    {
+      int32_t l = hi;
+      while(l > 0 && abs(a(l, l - 1)) > eps * (abs(a(l - 1, l - 1)) + abs(a(l, l))))
+        l--;
+      if(l > 0)
+        a(l, l - 1) = 0;
+      if(l == hi)
+      {
+        values[hi--] = a(l, l);
+        iterations = 0;
+        continue;
+      }
+      if(++iterations > 100 * m)
+        throw domain_error("Hessenberg QR did not converge: krylov.");
+
+      // Eigenvalue of the trailing 2 x 2 closest to the corner, with an
+      // occasional exceptional shift to break cycles
+      complex<T> sigma;
+      if(iterations % 11 == 10)
+        sigma = a(hi, hi) + abs(a(hi, hi - 1));
+      else
+      {
+        complex<T> half = (a(hi - 1, hi - 1) + a(hi, hi)) / T(2);
+        complex<T> root = sqrt(half * half - (a(hi - 1, hi - 1) * a(hi, hi) - a(hi - 1, hi) * a(hi, hi - 1)));
+        sigma = abs(half + root - a(hi, hi)) < abs(half - root - a(hi, hi)) ? half + root : half - root;
+      }
+
+      for(int32_t i = l; i <= hi; i++)
+        a(i, i) -= sigma;
+      for(int32_t i = l; i < hi; i++)
+      {
+        complex<T> x = a(i, i);
+        complex<T> y = a(i + 1, i);
+        T r = hypot(abs(x), abs(y));
+        if(r == T(0))
+        {
+          cs[i] = 1;
+          sn[i] = 0;
+          continue;
+        }
+        cs[i] = abs(x) / r;
+        sn[i] = abs(x) == T(0) ? conj(y) / abs(y) : (x / abs(x)) * conj(y) / r;
+        for(int32_t j = i; j <= hi; j++)
+        {
+          complex<T> p = a(i, j);
+          complex<T> q = a(i + 1, j);
+          a(i, j) = cs[i] * p + sn[i] * q;
+          a(i + 1, j) = -conj(sn[i]) * p + cs[i] * q;
+        }
+      }
+      for(int32_t i = l; i < hi; i++)
+        for(int32_t r = l; r <= min(i + 2, hi); r++)
+        {
+          complex<T> p = a(r, i);
+          complex<T> q = a(r, i + 1);
+          a(r, i) = p * cs[i] + q * conj(sn[i]);
+          a(r, i + 1) = -p * sn[i] + q * cs[i];
+        }
+      for(int32_t i = l; i <= hi; i++)
+        a(i, i) += sigma;
+    }
+    return values;
+  }
+
+  template <typename T>
+  vector<complex<T>> nullVector(const vector<T>& H, uint32_t m, complex<T> theta)
+  {
+    // Inverse iteration on H - theta I, nudging tiny pivots the way
+    // EISPACK's invit does
+    T largest = 0;
+    for(T h : H)
+      largest = max(largest, T(fabs(h)));
+    T small = numeric_limits<T>::epsilon() * max(largest, T(1));
+
+    vector<complex<T>> B(H.begin(), H.end());
+    vector<uint32_t> pivots(m);
+    auto b = [&](uint32_t i, uint32_t j) -> complex<T>& { return B[i * m + j]; };
+    for(uint32_t i = 0; i < m; i++)
+      b(i, i) -= theta;
+    for(uint32_t j = 0; j < m; j++)
+    {
+      uint32_t p = j;
+      for(uint32_t i = j + 1; i < m; i++)
+        if(abs(b(i, j)) > abs(b(p, j)))
+          p = i;
+      pivots[j] = p;
+      if(p != j)
+        for(uint32_t c = 0; c < m; c++)
+          swap(b(j, c), b(p, c));
+      if(abs(b(j, j)) < small)
+        b(j, j) = small;
+      for(uint32_t i = j + 1; i < m; i++)
+      {
+        b(i, j) /= b(j, j);
+        for(uint32_t c = j + 1; c < m; c++)
+          b(i, c) -= b(i, j) * b(j, c);
+      }
+    }
+
+    vector<complex<T>> y(m, complex<T>(1));
+    for(uint32_t pass = 0; pass < 2; pass++)
+    {
+      for(uint32_t j = 0; j < m; j++)
+        swap(y[j], y[pivots[j]]);
+      for(uint32_t i = 1; i < m; i++)
+        for(uint32_t j = 0; j < i; j++)
+          y[i] -= b(i, j) * y[j];
+      for(int32_t i = m - 1; i >= 0; i--)
+      {
+        for(uint32_t j = i + 1; j < m; j++)
+          y[i] -= b(i, j) * y[j];
+        y[i] /= b(i, i);
+      }
+      T length = 0;
+      for(const complex<T>& z : y)
+        length += norm(z);
+      length = sqrt(length);
+      for(complex<T>& z : y)
+        z /= length;
+    }
+    return y;
+  }
+
+  template <typename S>
+  vector<uint32_t> order(const vector<S>& values, EigenTarget target)
+  {
+    vector<uint32_t> index(values.size());
+    for(uint32_t i = 0; i < index.size(); i++)
+      index[i] = i;
+    auto key = [&](uint32_t i)
+    {
+      switch(target)
+      {
+        case LARGEST_MAGNITUDE: return -abs(values[i]);
+        case SMALLEST_MAGNITUDE: return abs(values[i]);
+        case LARGEST_REAL: return -real(values[i]);
+        default: return real(values[i]);
+      }
+    };
+    stable_sort(index.begin(), index.end(), [&](uint32_t a, uint32_t b) { return key(a) < key(b); });
+    return index;
+  }
+}
+
+template <typename T, class MATRIX>
+void LanczosEigensolver::operator()(const MATRIX& A, uint32_t k, EigenTarget target, MathVector<T>& values, DenseMatrix<T>& vectors)
+{
+  TraceSpan span("LanczosEigensolver::solve");
+  uint32_t n = A.getNumRows();
+  if(k == 0 || k >= n)
+    throw domain_error("Need 0 < k < n: LanczosEigensolver.");
+  uint32_t m = min(n, max(m_basis_size == 0 ? max(2 * k + 1, 20u) : m_basis_size, k + 1));
+  const T eps = numeric_limits<T>::epsilon();
+
+  MathVector<T> f(n);
+  for(uint32_t i = 0; i < n; i++)
+    f.push(0);
+  vector<MathVector<T>> V(m, f);
+  vector<T> H(m * m, T(0));
+  vector<T> Q;
+  vector<T> Z;
+  vector<T> d(m);
+  vector<T> e(m);
+  vector<T> M(m * m);
+  vector<T> theta;
+  vector<uint32_t> index;
+  mt19937 generator(1);
+
+  krylov::randomVector(V, 0, V[0], generator);
+  krylov::extend(A, V, f, H, m, 0, generator);
+  for(m_restarts = 0; ; m_restarts++)
+  {
+    TraceSpan restart_span("LanczosEigensolver::restart");
+
+    // Only the tridiagonal part of H is kept; the rest is roundoff
+    for(uint32_t i = 0; i < m; i++)
+    {
+      d[i] = H[i * m + i];
+      e[i] = i + 1 < m ? H[(i + 1) * m + i] : T(0);
+    }
+    theta = d;
+    krylov::tridiagonalEigen(theta, e, Z, m);
+    index = krylov::order(theta, target);
+
+    T beta = sqrt(f * f);
+    m_converged = 0;
+    for(uint32_t i = 0; i < k; i++)
+      if(beta * fabs(Z[(m - 1) * m + index[i]]) <= m_tolerance * max(T(fabs(theta[index[i]])), T(pow(eps, T(2) / 3))))
+        m_converged++;
+    if(m_converged == k || m_restarts == m_max_restarts || m == n)
+      break;
+
+    // Unwanted Ritz values as exact shifts on the symmetric tridiagonal
+    fill(H.begin(), H.end(), T(0));
+    for(uint32_t i = 0; i < m; i++)
+    {
+      H[i * m + i] = d[i];
+      if(i + 1 < m)
+        H[(i + 1) * m + i] = H[i * m + i + 1] = e[i];
+    }
+    Q.assign(m * m, T(0));
+    for(uint32_t i = 0; i < m; i++)
+      Q[i * m + i] = 1;
+    for(uint32_t s = k; s < m; s++)
+    {
+      M = H;
+      for(uint32_t i = 0; i < m; i++)
+        M[i * m + i] -= theta[index[s]];
+      krylov::shift(H, M, Q, m);
+    }
+    krylov::compress(V, f, H, Q, m, k);
+    krylov::extend(A, V, f, H, m, k, generator);
+  }
+
+  // Ritz vectors V z for the wanted values
+  values = MathVector<T>(k);
+  vectors = DenseMatrix<T>(k, n);
+  for(uint32_t i = 0; i < k; i++)
+  {
+    values.push(theta[index[i]]);
+    T * x = vectors[i].data();
+    for(uint32_t j = 0; j < m; j++)
+    {
+      T z = Z[j * m + index[i]];
+      const T * v = V[j].data();
+      for(uint32_t r = 0; r < n; r++)
+        x[r] += z * v[r];
+    }
+  }
+}
+
+template <typename T, class MATRIX>
+void ArnoldiEigensolver::operator()(const MATRIX& A, uint32_t k, EigenTarget target,
+                                    MathVector<complex<T>>& values, DenseMatrix<complex<T>>& vectors)
+{
+  TraceSpan span("ArnoldiEigensolver::solve");
+  uint32_t n = A.getNumRows();
+  if(k == 0 || k >= n)
+    throw domain_error("Need 0 < k < n: ArnoldiEigensolver.");
+  uint32_t m = min(n, max(m_basis_size == 0 ? max(2 * k + 1, 20u) : m_basis_size, k + 2));
+  const T eps = numeric_limits<T>::epsilon();
+  const T pair_tolerance = sqrt(eps);
+
+  MathVector<T> f(n);
+  for(uint32_t i = 0; i < n; i++)
+    f.push(0);
+  vector<MathVector<T>> V(m, f);
+  vector<T> H(m * m, T(0));
+  vector<T> Q;
+  vector<T> M(m * m);
+  vector<complex<T>> theta;
+  vector<uint32_t> index;
+  mt19937 generator(1);
+
+  krylov::randomVector(V, 0, V[0], generator);
+  krylov::extend(A, V, f, H, m, 0, generator);
+  for(m_restarts = 0; ; m_restarts++)
+  {
+    TraceSpan restart_span("ArnoldiEigensolver::restart");
+    theta = krylov::hessenbergEigenvalues(H, m);
+    index = krylov::order(theta, target);
+    auto complex_value = [&](complex<T> z) { return fabs(z.imag()) > pair_tolerance * abs(z); };
+
+    T beta = sqrt(f * f);
+    m_converged = 0;
+    for(uint32_t i = 0; i < k; i++)
+    {
+      vector<complex<T>> y = krylov::nullVector(H, m, theta[index[i]]);
+      if(beta * abs(y[m - 1]) <= m_tolerance * max(abs(theta[index[i]]), T(pow(eps, T(2) / 3))))
+        m_converged++;
+    }
+    if(m_converged == k || m_restarts == m_max_restarts || m == n)
+      break;
+
+    // Never split a conjugate pair between wanted and unwanted
+    uint32_t keep = k;
+    if(complex_value(theta[index[keep - 1]]) && keep < m &&
+       abs(theta[index[keep]] - conj(theta[index[keep - 1]])) <= pair_tolerance * abs(theta[index[keep]]))
+      keep++;
+
+    // Real shifts one at a time, conjugate pairs as one real double
+    // shift (H - mu I)(H - conj(mu) I). Unpaired complex values are
+    // skipped, and the basis keeps m minus the shifts applied.
+    Q.assign(m * m, T(0));
+    for(uint32_t i = 0; i < m; i++)
+      Q[i * m + i] = 1;
+    vector<bool> used(m, false);
+    uint32_t applied = 0;
+    for(uint32_t s = keep; s < m; s++)
+    {
+      if(used[s])
+        continue;
+      complex<T> mu = theta[index[s]];
+      if(!complex_value(mu))
+      {
+        M = H;
+        for(uint32_t i = 0; i < m; i++)
+          M[i * m + i] -= mu.real();
+        krylov::shift(H, M, Q, m);
+        applied++;
+        continue;
+      }
+
+      uint32_t partner = m;
+      for(uint32_t t = s + 1; t < m; t++)
+        if(!used[t] && abs(theta[index[t]] - conj(mu)) <= pair_tolerance * abs(mu))
+        {
+          partner = t;
+          break;
+        }
+      if(partner == m)
+        continue;
+      used[partner] = true;
+
+      // H^2 - 2 Re(mu) H + |mu|^2 I
+      for(uint32_t i = 0; i < m; i++)
+        for(uint32_t j = 0; j < m; j++)
+        {
+          T sum = 0;
+          for(uint32_t l = 0; l < m; l++)
+            sum += H[i * m + l] * H[l * m + j];
+          M[i * m + j] = sum - 2 * mu.real() * H[i * m + j] + (i == j ? norm(mu) : T(0));
+        }
+      krylov::shift(H, M, Q, m);
+      applied += 2;
+    }
+    if(applied == 0)
+      break;
+    krylov::compress(V, f, H, Q, m, m - applied);
+    krylov::extend(A, V, f, H, m, m - applied, generator);
+  }
+
+  // Ritz vectors V y for the wanted values
+  values = MathVector<complex<T>>(k);
+  vectors = DenseMatrix<complex<T>>(k, n);
+  for(uint32_t i = 0; i < k; i++)
+  {
+    values.push(theta[index[i]]);
+    vector<complex<T>> y = krylov::nullVector(H, m, theta[index[i]]);
+    complex<T> * x = vectors[i].data();
+    for(uint32_t j = 0; j < m; j++)
+    {
+      const T * v = V[j].data();
+      for(uint32_t r = 0; r < n; r++)
+        x[r] += y[j] * v[r];
+    }
+  }
+}
+
+#endif //KRYLOV_EIGEN_HPP
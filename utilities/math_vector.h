@@ -48,6 +48,15 @@
 /// @return Returns m_capacity of the called object.
 //////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////
+/// @fn T * T::data()
+/// @brief Get function for m_elements, for kernels that should skip
+///        the bounds checked [] operator.
+/// @pre None.
+/// @post Returns pointer to the first of size() contiguous elements.
+/// @return Returns m_elements of the called object.
+//////////////////////////////////////////////////////////////////////
+
 //////////////////////////////////////////////////////////////////////
 /// @fn T MathVector<T>::operator [](int index) const
 /// @brief Returns a returns element at passed index.
@@ -163,6 +172,8 @@ public:
   // Getters
   uint32_t size() const;
   uint32_t capacity() const;
+  T * data() { return m_elements; }
+  const T * data() const { return m_elements; }
 
   // Functions
   bool push(T element);
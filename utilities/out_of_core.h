@@ -0,0 +1,131 @@
+//////////////////////////////////////////////////////////////////////
+/// @file out_of_core.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the TileStream class
+///        and the out of core multiply and factorizations on TiledMatrix
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class TileStream
+/// @brief Runs a sequence of tile tasks with double buffered I/O. While
+///        task s computes, the tiles of task s + 1 are read by the
+///        TiledMatrix::io() thread into the other set of buffers, and
+///        the tiles task s - 1 changed are written back behind it.
+///        Compute itself goes through blas and the shared pool, so it
+///        runs at in-memory speed as long as a tile's flops outlast
+///        its transfer.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void run(uint32_t count, REFS refs, COMPUTE compute)
+/// @brief Runs tasks 0 .. count - 1 in order.
+/// @pre refs(s, v) fills v with the TileRefs of task s: tiles marked
+///      read are loaded before compute(s, tiles) is called, tiles
+///      marked written are stored after it returns. tiles[k] belongs
+///      to v[k]. A task lists each tile it writes once.
+/// @post Every write has reached the file.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void tiled_gemm(T alpha, const TiledMatrix<T>& A, const TiledMatrix<T>& B, T beta, TiledMatrix<T>& C)
+/// @brief C = alpha * A * B + beta * C one tile of C at a time, A's
+///        tile row streaming past B's tile column.
+/// @pre Sizes agree, all three share a tile size and C is neither A
+///      nor B.
+/// @post C holds the result.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void tiled_lu(TiledMatrix<T>& A)
+/// @brief Right looking tile LU in place: unit L below the diagonal,
+///        U on and above it. There is no pivoting, since a pivot search
+///        would need a whole column of tiles in memory.
+/// @pre A is square and needs no pivoting, e.g. diagonally dominant.
+/// @post A holds L and U. Throws domain_error on a zero pivot.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void tiled_cholesky(TiledMatrix<T>& A)
+/// @brief Right looking tile Cholesky in place. Only tiles on and below
+///        the diagonal are read or written.
+/// @pre A is symmetric positive definite.
+/// @post The lower triangle of A holds L with A = L L^T, the upper
+///       triangle of the diagonal tiles is zeroed. Throws domain_error
+///       if A is not positive definite.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void tiled_lu_solve(const TiledMatrix<T>& LU, MathVector<T>& b)
+/// @fn void tiled_cholesky_solve(const TiledMatrix<T>& L, MathVector<T>& b)
+/// @brief Forward and back substitution streaming the factor tiles.
+/// @pre The factor came from tiled_lu() or tiled_cholesky() and b has
+///      one entry per row.
+/// @post b holds x.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef OUT_OF_CORE_H
+#define OUT_OF_CORE_H
+
+#include <future>
+#include <vector>
+#include "../matrices/tiled_matrix.h"
+#include "blas.h"
+#include "thread_pool.h"
+#include "trace.h"
+
+using namespace std;
+
+template <typename T>
+struct TileRef
+{
+  TiledMatrix<T>* matrix;
+  uint32_t I;
+  uint32_t J;
+  bool read;
+  bool written;
+};
+
+template <typename T>
+class TileStream
+{
+private:
+  struct Slot
+  {
+    vector<TileRef<T>> refs;
+    vector<DenseMatrix<T>> tiles;
+    future<void> reads;
+    future<void> writes;
+  };
+
+  uint32_t m_tile;
+  Slot m_slots[2];
+
+  void issue(Slot& slot);
+  void retire(Slot& slot);
+  static bool conflicts(const Slot& later, const Slot& earlier);
+
+public:
+  TileStream(uint32_t tile) : m_tile(tile) {};
+
+  template <class REFS, class COMPUTE>
+  void run(uint32_t count, REFS refs, COMPUTE compute);
+};
+
+template <typename T>
+void tiled_gemm(T alpha, const TiledMatrix<T>& A, const TiledMatrix<T>& B, T beta, TiledMatrix<T>& C);
+
+template <typename T>
+void tiled_lu(TiledMatrix<T>& A);
+
+template <typename T>
+void tiled_cholesky(TiledMatrix<T>& A);
+
+template <typename T>
+void tiled_lu_solve(const TiledMatrix<T>& LU, MathVector<T>& b);
+
+template <typename T>
+void tiled_cholesky_solve(const TiledMatrix<T>& L, MathVector<T>& b);
+
+#include "out_of_core.hpp"
+
+#endif //OUT_OF_CORE_H
@@ -0,0 +1,554 @@
+//////////////////////////////////////////////////////////////////////
+/// @file out_of_core.hpp
+/// @author Connor McBride
+/// @brief Contains the TileStream and out of core algorithm
+///        implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef OUT_OF_CORE_HPP
+#define OUT_OF_CORE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+template <typename T>
+void TileStream<T>::issue(Slot& slot)
+{
+  while(slot.tiles.size() < slot.refs.size())
+    slot.tiles.emplace_back(m_tile, m_tile);
+  Slot * p = &slot;
+  slot.reads = TiledMatrix<T>::io().submit([p]
+  {
+    for(uint32_t k = 0; k < p->refs.size(); k++)
+      if(p->refs[k].read)
+        p->refs[k].matrix->readTile(p->refs[k].I, p->refs[k].J, p->tiles[k]);
+  });
+}
+
+template <typename T>
+void TileStream<T>::retire(Slot& slot)
+{
+  Slot * p = &slot;
+  slot.writes = TiledMatrix<T>::io().submit([p]
+  {
+    for(uint32_t k = 0; k < p->refs.size(); k++)
+      if(p->refs[k].written)
+        p->refs[k].matrix->writeTile(p->refs[k].I, p->refs[k].J, p->tiles[k]);
+  });
+}
+
+template <typename T>
+bool TileStream<T>::conflicts(const Slot& later, const Slot& earlier)
+{
+  for(const TileRef<T>& r : later.refs)
+    for(const TileRef<T>& w : earlier.refs)
+      if(r.read && w.written && r.matrix == w.matrix && r.I == w.I && r.J == w.J)
+        return true;
+  return false;
+}
+
+template <typename T>
+template <class REFS, class COMPUTE>
+void TileStream<T>::run(uint32_t count, REFS refs, COMPUTE compute)
+{
+  if(count == 0)
+    return;
+
+  try
+  {
+    m_slots[0].refs.clear();
+    refs(0, m_slots[0].refs);
+    issue(m_slots[0]);
+    for(uint32_t s = 0; s < count; s++)
+    {
+      Slot& now = m_slots[s % 2];
+      Slot& next = m_slots[(s + 1) % 2];
+
+      // Prefetch the next task unless it reads a tile this one writes;
+      // then its reads are queued behind this task's writes instead
+      bool ahead = false;
+      if(s + 1 < count)
+      {
+        if(next.writes.valid())
+          next.writes.get();
+        next.refs.clear();
+        refs(s + 1, next.refs);
+        if(!conflicts(next, now))
+        {
+          issue(next);
+          ahead = true;
+        }
+      }
+
+      now.reads.get();
+      compute(s, now.tiles);
+      retire(now);
+      if(s + 1 < count && !ahead)
+        issue(next);
+    }
+  }
+  catch(...)
+  {
+    // The I/O thread still holds the slot buffers
+    for(Slot& slot : m_slots)
+    {
+      if(slot.reads.valid())
+        slot.reads.wait();
+      if(slot.writes.valid())
+        slot.writes.wait();
+    }
+    throw;
+  }
+
+  for(Slot& slot : m_slots)
+  {
+    if(slot.reads.valid())
+      slot.reads.get();
+    if(slot.writes.valid())
+      slot.writes.get();
+  }
+}
+
+namespace out_of_core
+{
+  // Rows of a tile handed out at a time by the panel kernels
+  const uint32_t GRAIN = 16;
+
+  // Valid rows (or columns) of tile I of an n long dimension
+  inline uint32_t extent(uint32_t n, uint32_t tile, uint32_t I)
+  {
+    return min(tile, n - I * tile);
+  }
+
+  // In place unpivoted LU of the leading v x v block
+  template <typename T>
+  void factorLU(DenseMatrix<T>& D, uint32_t v)
+  {
+    for(uint32_t p = 0; p < v; p++)
+    {
+      const T * row_p = D[p].data();
+      if(row_p[p] == T(0))
+        throw domain_error("Zero pivot: tiled_lu.");
+      for(uint32_t i = p + 1; i < v; i++)
+      {
+        T * row_i = D[i].data();
+        T l = row_i[p] / row_p[p];
+        row_i[p] = l;
+        for(uint32_t c = p + 1; c < v; c++)
+          row_i[c] -= l * row_p[c];
+      }
+    }
+  }
+
+  // In place Cholesky of the leading v x v block, upper triangle zeroed
+  template <typename T>
+  void factorCholesky(DenseMatrix<T>& D, uint32_t v)
+  {
+    for(uint32_t j = 0; j < v; j++)
+    {
+      T * row_j = D[j].data();
+      T d = row_j[j];
+      for(uint32_t p = 0; p < j; p++)
+        d -= row_j[p] * row_j[p];
+      if(!(d > T(0)))
+        throw domain_error("Matrix is not positive definite: tiled_cholesky.");
+      row_j[j] = sqrt(d);
+      fill(row_j + j + 1, row_j + v, T(0));
+      for(uint32_t i = j + 1; i < v; i++)
+      {
+        T * row_i = D[i].data();
+        T sum = row_i[j];
+        for(uint32_t p = 0; p < j; p++)
+          sum -= row_i[p] * row_j[p];
+        row_i[j] = sum / row_j[j];
+      }
+    }
+  }
+
+  // B = L^-1 B for the unit lower triangle of D, split by columns
+  template <typename T>
+  void solveLowerUnit(const DenseMatrix<T>& D, DenseMatrix<T>& B, uint32_t v)
+  {
+    uint32_t t = B.getNumColumns();
+    ThreadPool::shared().parallelFor(0, t, 4 * GRAIN, [&](uint32_t c0, uint32_t c1)
+    {
+      for(uint32_t i = 1; i < v; i++)
+      {
+        const T * l = D[i].data();
+        T * b_i = B[i].data();
+        for(uint32_t p = 0; p < i; p++)
+        {
+          const T * b_p = B[p].data();
+          for(uint32_t c = c0; c < c1; c++)
+            b_i[c] -= l[p] * b_p[c];
+        }
+      }
+    });
+  }
+
+  // B = B U^-1 for the upper triangle of D, split by rows
+  template <typename T>
+  void solveUpperRight(const DenseMatrix<T>& D, DenseMatrix<T>& B, uint32_t v)
+  {
+    ThreadPool::shared().parallelFor(0, B.getNumRows(), GRAIN, [&](uint32_t r0, uint32_t r1)
+    {
+      for(uint32_t r = r0; r < r1; r++)
+      {
+        T * b = B[r].data();
+        for(uint32_t p = 0; p < v; p++)
+        {
+          const T * u = D[p].data();
+          b[p] /= u[p];
+          for(uint32_t c = p + 1; c < v; c++)
+            b[c] -= b[p] * u[c];
+        }
+      }
+    });
+  }
+
+  // B = B L^-T for the lower triangle of D, split by rows
+  template <typename T>
+  void solveLowerTransposeRight(const DenseMatrix<T>& D, DenseMatrix<T>& B, uint32_t v)
+  {
+    ThreadPool::shared().parallelFor(0, B.getNumRows(), GRAIN, [&](uint32_t r0, uint32_t r1)
+    {
+      for(uint32_t r = r0; r < r1; r++)
+      {
+        T * b = B[r].data();
+        for(uint32_t j = 0; j < v; j++)
+        {
+          const T * l = D[j].data();
+          T sum = b[j];
+          for(uint32_t p = 0; p < j; p++)
+            sum -= b[p] * l[p];
+          b[j] = sum / l[j];
+        }
+      }
+    });
+  }
+
+  // y -= D x, or D^T x with transpose
+  template <typename T>
+  void subtractProduct(const DenseMatrix<T>& D, const T * x, T * y, bool transpose)
+  {
+    uint32_t t = D.getNumRows();
+    for(uint32_t r = 0; r < t; r++)
+    {
+      const T * d = D[r].data();
+      if(transpose)
+      {
+        for(uint32_t c = 0; c < t; c++)
+          y[c] -= d[c] * x[r];
+      }
+      else
+      {
+        T sum = 0;
+        for(uint32_t c = 0; c < t; c++)
+          sum += d[c] * x[c];
+        y[r] -= sum;
+      }
+    }
+  }
+}
+
+template <typename T>
+void tiled_gemm(T alpha, const TiledMatrix<T>& A, const TiledMatrix<T>& B, T beta, TiledMatrix<T>& C)
+{
+  TraceSpan span("tiled_gemm");
+  if(A.getNumColumns() != B.getNumRows() || C.getNumRows() != A.getNumRows() || C.getNumColumns() != B.getNumColumns())
+    throw domain_error("Matrix sizes not compatible: tiled_gemm.");
+  if(A.tileSize() != C.tileSize() || B.tileSize() != C.tileSize())
+    throw domain_error("Tile sizes differ: tiled_gemm.");
+  if(&A == &C || &B == &C)
+    throw domain_error("C may not alias A or B: tiled_gemm.");
+
+  uint32_t t = C.tileSize();
+  uint32_t ni = C.tileRows();
+  uint32_t nj = C.tileColumns();
+  uint32_t nk = A.tileColumns();
+  TiledMatrix<T>* a = const_cast<TiledMatrix<T>*>(&A);
+  TiledMatrix<T>* b = const_cast<TiledMatrix<T>*>(&B);
+  DenseMatrix<T> acc(t, t);
+  TileStream<T> stream(t);
+
+  // Tile (I, J) of C sums over K, its accumulator staying in memory
+  auto index = [nj, nk](uint32_t s, uint32_t& I, uint32_t& J, uint32_t& K)
+  {
+    K = s % nk;
+    J = (s / nk) % nj;
+    I = s / (nk * nj);
+  };
+  stream.run(ni * nj * nk, [&](uint32_t s, vector<TileRef<T>>& refs)
+  {
+    uint32_t I, J, K;
+    index(s, I, J, K);
+    refs.push_back({a, I, K, true, false});
+    refs.push_back({b, K, J, true, false});
+    bool read_c = K == 0 && beta != T(0);
+    if(read_c || K + 1 == nk)
+      refs.push_back({&C, I, J, read_c, K + 1 == nk});
+  }, [&](uint32_t s, vector<DenseMatrix<T>>& tiles)
+  {
+    uint32_t I, J, K;
+    index(s, I, J, K);
+    if(K == 0)
+      for(uint32_t r = 0; r < t; r++)
+      {
+        T * row = acc[r].data();
+        if(beta == T(0))
+          fill(row, row + t, T(0));
+        else
+        {
+          const T * c = tiles[2][r].data();
+          for(uint32_t j = 0; j < t; j++)
+            row[j] = beta * c[j];
+        }
+      }
+    gemm(alpha, tiles[0], tiles[1], T(1), acc);
+    if(K + 1 == nk)
+      for(uint32_t r = 0; r < t; r++)
+        copy(acc[r].data(), acc[r].data() + t, tiles[2][r].data());
+  });
+}
+
+template <typename T>
+void tiled_lu(TiledMatrix<T>& A)
+{
+  TraceSpan span("tiled_lu");
+  if(A.getNumRows() != A.getNumColumns())
+    throw domain_error("Matrix must be square: tiled_lu.");
+  enum Kind { FACTOR, ROW, COLUMN, UPDATE };
+  struct Step { Kind kind; uint32_t k, i, j; };
+
+  // Step k factors the diagonal tile, solves the tile row and column
+  // next to it and updates the trailing tiles
+  uint32_t n = A.getNumRows();
+  uint32_t t = A.tileSize();
+  uint32_t nt = A.tileRows();
+  vector<Step> steps;
+  for(uint32_t k = 0; k < nt; k++)
+  {
+    steps.push_back({FACTOR, k, k, k});
+    for(uint32_t j = k + 1; j < nt; j++)
+      steps.push_back({ROW, k, k, j});
+    for(uint32_t i = k + 1; i < nt; i++)
+      steps.push_back({COLUMN, k, i, k});
+    for(uint32_t i = k + 1; i < nt; i++)
+      for(uint32_t j = k + 1; j < nt; j++)
+        steps.push_back({UPDATE, k, i, j});
+  }
+
+  TileStream<T> stream(t);
+  stream.run(steps.size(), [&](uint32_t s, vector<TileRef<T>>& refs)
+  {
+    const Step& st = steps[s];
+    if(st.kind == UPDATE)
+    {
+      refs.push_back({&A, st.i, st.k, true, false});
+      refs.push_back({&A, st.k, st.j, true, false});
+    }
+    else if(st.kind != FACTOR)
+      refs.push_back({&A, st.k, st.k, true, false});
+    refs.push_back({&A, st.i, st.j, true, true});
+  }, [&](uint32_t s, vector<DenseMatrix<T>>& tiles)
+  {
+    const Step& st = steps[s];
+    uint32_t v = out_of_core::extent(n, t, st.k);
+    if(st.kind == FACTOR)
+      out_of_core::factorLU(tiles[0], v);
+    else if(st.kind == ROW)
+      out_of_core::solveLowerUnit(tiles[0], tiles[1], v);
+    else if(st.kind == COLUMN)
+      out_of_core::solveUpperRight(tiles[0], tiles[1], v);
+    else
+      gemm(T(-1), tiles[0], tiles[1], T(1), tiles[2]);
+  });
+}
+
+template <typename T>
+void tiled_cholesky(TiledMatrix<T>& A)
+{
+  TraceSpan span("tiled_cholesky");
+  if(A.getNumRows() != A.getNumColumns())
+    throw domain_error("Matrix must be square: tiled_cholesky.");
+  enum Kind { FACTOR, COLUMN, UPDATE };
+  struct Step { Kind kind; uint32_t k, i, j; };
+
+  uint32_t n = A.getNumRows();
+  uint32_t t = A.tileSize();
+  uint32_t nt = A.tileRows();
+  vector<Step> steps;
+  for(uint32_t k = 0; k < nt; k++)
+  {
+    steps.push_back({FACTOR, k, k, k});
+    for(uint32_t i = k + 1; i < nt; i++)
+      steps.push_back({COLUMN, k, i, k});
+    for(uint32_t i = k + 1; i < nt; i++)
+      for(uint32_t j = k + 1; j <= i; j++)
+        steps.push_back({UPDATE, k, i, j});
+  }
+
+  DenseMatrix<T> transposed(t, t);
+  TileStream<T> stream(t);
+  stream.run(steps.size(), [&](uint32_t s, vector<TileRef<T>>& refs)
+  {
+    const Step& st = steps[s];
+    if(st.kind == UPDATE)
+    {
+      refs.push_back({&A, st.i, st.k, true, false});
+      refs.push_back({&A, st.j, st.k, true, false});
+    }
+    else if(st.kind == COLUMN)
+      refs.push_back({&A, st.k, st.k, true, false});
+    refs.push_back({&A, st.i, st.j, true, true});
+  }, [&](uint32_t s, vector<DenseMatrix<T>>& tiles)
+  {
+    const Step& st = steps[s];
+    uint32_t v = out_of_core::extent(n, t, st.k);
+    if(st.kind == FACTOR)
+      out_of_core::factorCholesky(tiles[0], v);
+    else if(st.kind == COLUMN)
+      out_of_core::solveLowerTransposeRight(tiles[0], tiles[1], v);
+    else
+    {
+      // A(i, j) -= L(i, k) L(j, k)^T
+      for(uint32_t r = 0; r < t; r++)
+      {
+        const T * row = tiles[1][r].data();
+        for(uint32_t c = 0; c < t; c++)
+          transposed[c].data()[r] = row[c];
+      }
+      gemm(T(-1), tiles[0], transposed, T(1), tiles[2]);
+    }
+  });
+}
+
+template <typename T>
+void tiled_lu_solve(const TiledMatrix<T>& LU, MathVector<T>& b)
+{
+  TraceSpan span("tiled_lu_solve");
+  uint32_t n = LU.getNumRows();
+  uint32_t t = LU.tileSize();
+  uint32_t nt = LU.tileRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: tiled_lu_solve.");
+  TiledMatrix<T>* f = const_cast<TiledMatrix<T>*>(&LU);
+  vector<T> x(size_t(nt) * t, T(0));
+  copy(b.data(), b.data() + n, x.begin());
+
+  // Forward through the tiles on and below the diagonal, row by row,
+  // then back through those on and above it
+  vector<pair<uint32_t, uint32_t>> order;
+  for(uint32_t I = 0; I < nt; I++)
+    for(uint32_t J = 0; J <= I; J++)
+      order.push_back({I, J});
+  for(uint32_t I = nt; I-- > 0; )
+    for(uint32_t J = nt; J-- > I; )
+      order.push_back({I, J});
+  uint32_t forward = nt * (nt + 1) / 2;
+
+  TileStream<T> stream(t);
+  stream.run(order.size(), [&](uint32_t s, vector<TileRef<T>>& refs)
+  {
+    refs.push_back({f, order[s].first, order[s].second, true, false});
+  }, [&](uint32_t s, vector<DenseMatrix<T>>& tiles)
+  {
+    uint32_t I = order[s].first;
+    uint32_t J = order[s].second;
+    const DenseMatrix<T>& D = tiles[0];
+    T * y = x.data() + size_t(I) * t;
+    uint32_t v = out_of_core::extent(n, t, I);
+    if(I != J)
+      out_of_core::subtractProduct(D, x.data() + size_t(J) * t, y, false);
+    else if(s < forward)
+    {
+      for(uint32_t i = 1; i < v; i++)
+        for(uint32_t p = 0; p < i; p++)
+          y[i] -= D[i].data()[p] * y[p];
+    }
+    else
+    {
+      for(uint32_t i = v; i-- > 0; )
+      {
+        const T * u = D[i].data();
+        for(uint32_t p = i + 1; p < v; p++)
+          y[i] -= u[p] * y[p];
+        y[i] /= u[i];
+      }
+    }
+  });
+
+  copy(x.begin(), x.begin() + n, b.data());
+}
+
+template <typename T>
+void tiled_cholesky_solve(const TiledMatrix<T>& L, MathVector<T>& b)
+{
+  TraceSpan span("tiled_cholesky_solve");
+  uint32_t n = L.getNumRows();
+  uint32_t t = L.tileSize();
+  uint32_t nt = L.tileRows();
+  if(b.size() != n)
+    throw domain_error("Vector size not compatible: tiled_cholesky_solve.");
+  TiledMatrix<T>* f = const_cast<TiledMatrix<T>*>(&L);
+  vector<T> x(size_t(nt) * t, T(0));
+  copy(b.data(), b.data() + n, x.begin());
+
+  // Ly = b row by row, then L^T x = y using tile (J, I) transposed for
+  // tile (I, J) of L^T
+  vector<pair<uint32_t, uint32_t>> order;
+  for(uint32_t I = 0; I < nt; I++)
+    for(uint32_t J = 0; J <= I; J++)
+      order.push_back({I, J});
+  for(uint32_t I = nt; I-- > 0; )
+    for(uint32_t J = nt; J-- > I; )
+      order.push_back({J, I});
+  uint32_t forward = nt * (nt + 1) / 2;
+
+  TileStream<T> stream(t);
+  stream.run(order.size(), [&](uint32_t s, vector<TileRef<T>>& refs)
+  {
+    refs.push_back({f, order[s].first, order[s].second, true, false});
+  }, [&](uint32_t s, vector<DenseMatrix<T>>& tiles)
+  {
+    const DenseMatrix<T>& D = tiles[0];
+    if(s < forward)
+    {
+      uint32_t I = order[s].first;
+      uint32_t J = order[s].second;
+      T * y = x.data() + size_t(I) * t;
+      uint32_t v = out_of_core::extent(n, t, I);
+      if(I != J)
+        out_of_core::subtractProduct(D, x.data() + size_t(J) * t, y, false);
+      else
+        for(uint32_t i = 0; i < v; i++)
+        {
+          const T * l = D[i].data();
+          for(uint32_t p = 0; p < i; p++)
+            y[i] -= l[p] * y[p];
+          y[i] /= l[i];
+        }
+    }
+    else
+    {
+      uint32_t J = order[s].first;
+      uint32_t I = order[s].second;
+      T * y = x.data() + size_t(I) * t;
+      uint32_t v = out_of_core::extent(n, t, I);
+      if(I != J)
+        out_of_core::subtractProduct(D, x.data() + size_t(J) * t, y, true);
+      else
+        for(uint32_t i = v; i-- > 0; )
+        {
+          for(uint32_t p = i + 1; p < v; p++)
+            y[i] -= D[p].data()[i] * y[p];
+          y[i] /= D[i].data()[i];
+        }
+    }
+  });
+
+  copy(x.begin(), x.begin() + n, b.data());
+}
+
+#endif //OUT_OF_CORE_HPP
@@ -29,10 +29,59 @@
 /// @param R the R factor of A
 //////////////////////////////////////////////////////////////////////
 
+//////////////////////////////////////////////////////////////////////
+/// @fn void operator ()(const FixedMatrix<T, M, N>& A, FixedMatrix<T, M, N>& Q, FixedMatrix<T, N, N>& R) const
+/// @brief Unrolled modified Gram-Schmidt for sizes known at compile time.
+/// @pre M >= N and the columns of A are linearly independent.
+/// @post Q has orthonormal columns, R is upper triangular and A = QR.
+/// @param A the matrix to be decomposed
+/// @param Q the Q factor of A
+/// @param R the R factor of A
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factorTransposed(const BaseMatrix<T>& A, DenseMatrix<T>& Qt, UpperTriMatrix<T>& R) const
+/// @brief Same factorization as above but hands back Q transposed, which
+///        is the form the solvers apply it in.
+/// @pre Matrix A passed should be representable as a square dense matrix
+/// @post Qt is the transpose of Q and R the R factor of A
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void factorInPlace(DenseMatrix<T>& A, UpperTriMatrix<T>& R) const
+/// @brief Overwrite mode. A's storage becomes Q transposed, so the only
+///        memory used is R (reused when it is already the right size)
+///        and one row.
+/// @pre A is square.
+/// @post A holds the transpose of Q and R the R factor of the old A
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void orthogonalize(DenseMatrix<T>& Qt, UpperTriMatrix<T>& R) const
+/// @brief Gram-Schmidt on the rows of Qt, which hold the columns of A.
+///        R is filled in from the same dot products as each row finishes.
+/// @pre Qt is the transpose of A.
+/// @post Qt is the transpose of Q and R the R factor of A
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void multiplyRQ(const UpperTriMatrix<T>& R, const DenseMatrix<T>& Qt, DenseMatrix<T>& C) const
+/// @brief C = R * Q straight from the stored rows of R and Qt, skipping
+///        the zeros below R's diagonal. The eigen iteration uses it below
+///        blas::STRASSEN_THRESHOLD and gemm with Qt transposed above.
+/// @pre R and Qt are n x n. C is not Qt.
+/// @post C holds the product, its storage reused when it fits.
+//////////////////////////////////////////////////////////////////////
+
 #ifndef QR_DECOMP_H
 #define QR_DECOMP_H
 
 #include "../matrices/dense_matrix.h"
+#include "../matrices/fixed_matrix.h"
+#include "../matrices/upper_tri_matrix.h"
+#include "blas.h"
+#include "result_writer.h"
+#include "trace.h"
 
 class QRDecomp
 {
@@ -43,6 +92,18 @@ public:
   template <typename T>
   void operator ()(const BaseMatrix<T>& A, DenseMatrix<T>& Q, UpperTriMatrix<T>& R) const;
 
+  template <typename T, uint32_t M, uint32_t N>
+  void operator ()(const FixedMatrix<T, M, N>& A, FixedMatrix<T, M, N>& Q, FixedMatrix<T, N, N>& R) const;
+
+  template <typename T>
+  void factorTransposed(const BaseMatrix<T>& A, DenseMatrix<T>& Qt, UpperTriMatrix<T>& R) const;
+  template <typename T>
+  void factorInPlace(DenseMatrix<T>& A, UpperTriMatrix<T>& R) const;
+  template <typename T>
+  void orthogonalize(DenseMatrix<T>& Qt, UpperTriMatrix<T>& R) const;
+  template <typename T>
+  void multiplyRQ(const UpperTriMatrix<T>& R, const DenseMatrix<T>& Qt, DenseMatrix<T>& C) const;
+
   string termination_reason() { return "Eigenvalues did not differ in two consecutive runs by a margin of 7 decimal points."; }
 };
 
@@ -10,7 +10,12 @@
 template <typename T>
 MathVector<T> QRDecomp::operator()(const unique_ptr<BaseMatrix<T>> A, int iterations) const
 {
-  unique_ptr<BaseMatrix<T>> Ak, Q, R;
+  DenseMatrix<T> Ak(A->clone());
+  DenseMatrix<T> Qt;
+  UpperTriMatrix<T> R;
+  // Dense copy of R for the Strassen path
+  DenseMatrix<T> Rd;
+  bool strassen = strassen_enabled() && A->getNumRows() >= blas::STRASSEN_THRESHOLD;
 
   // Eigenvalues to check for termination
   MathVector<T> pastEigen(A->getNumRows());
@@ -19,38 +24,56 @@ MathVector<T> QRDecomp::operator()(const unique_ptr<BaseMatrix<T>> A, int iterat
   // For each iteration
   for(int it = 0; it < iterations; it++)
   {
+    TraceSpan span("QRDecomp::eigenIteration");
+
     // Reset current eigenvalues
     currentEigen.setToZeroVector();
 
-    // If first round, Ak = A. else it is equal to previously factored R * Q
-    if(it == 0)
-      Ak = A->clone();
-    else
-      Ak = ((*R) * (*Q)).clone();
+    // If first round, Ak = A. else it is equal to previously factored R * Q,
+    // formed from Qt without building Q. Small Ak skips R's zeros; large
+    // Ak goes through gemm's Strassen path, which needs R dense
+    if(it > 0 && strassen)
+    {
+      uint32_t n = Qt.getNumRows();
+      if(Rd.getNumRows() != n || Rd.getNumColumns() != n)
+        Rd = DenseMatrix<T>(n, n);
+      for(uint32_t i = 0; i < n; i++)
+      {
+        // Row i of R is stored from column i on
+        T * row = Rd[i].data();
+        fill(row, row + i, T(0));
+        copy(R[i].data(), R[i].data() + (n - i), row + i);
+      }
+      gemm(blas::NO_TRANS, blas::TRANS, T(1), Rd, Qt, T(0), Ak);
+    }
+    else if(it > 0)
+      multiplyRQ(R, Qt, Ak);
 
     // Load current eigenvalues
-    for(uint32_t i = 0; i < Ak->getNumRows(); i++)
-      currentEigen.push((*Ak)(i, i));
+    for(uint32_t i = 0; i < Ak.getNumRows(); i++)
+      currentEigen.push(Ak(i, i));
 
     // If it's past the first iteration check to end
     if(it > 0)
     {
       if (currentEigen == pastEigen)
       {
-        cout << "=== Count iterations: " << it << " ===" << endl;
+        if(diagnostics_enabled())
+          cout << "=== Count iterations: " << it << " ===" << endl;
         break;
       }
     }
 
-    // Factor Ak into Q and R
-    (*this)(Ak, Q, R);
+    // Factor Ak into Q and R, Q kept transposed
+    factorTransposed(Ak, Qt, R);
 
     // Set past eigenvalues
     pastEigen = currentEigen;
   }
 
   // Output things
-  cout << Ak;
+  if(diagnostics_enabled())
+    cout << Ak;
 
   return currentEigen;
 }
@@ -58,30 +81,153 @@ MathVector<T> QRDecomp::operator()(const unique_ptr<BaseMatrix<T>> A, int iterat
 template <typename T>
 void QRDecomp::operator ()(const BaseMatrix<T>& A, DenseMatrix<T>& Q, UpperTriMatrix<T>& R) const
 {
-  DenseMatrix<T> Qt, X;
-  double top, bottom;
-  MathVector<T> temp;
+  DenseMatrix<T> Qt;
+
+  factorTransposed(A, Qt, R);
+
+  // Change values of passed in Q, reusing its storage when it fits
+  TraceSpan form_span("QRDecomp::formQR");
+  uint32_t n = Qt.getNumRows();
+  if(Q.getNumRows() != n || Q.getNumColumns() != n)
+    Q = DenseMatrix<T>(n, n);
+  for(uint32_t i = 0; i < n; i++)
+  {
+    T * q = Q[i].data();
+    for(uint32_t j = 0; j < n; j++)
+      q[j] = Qt[j].data()[i];
+  }
+}
+
+template <typename T>
+void QRDecomp::factorTransposed(const BaseMatrix<T>& A, DenseMatrix<T>& Qt, UpperTriMatrix<T>& R) const
+{
+  TraceSpan span("QRDecomp::factor");
+  uint32_t m = A.getNumRows();
+  uint32_t n = A.getNumColumns();
+
+  // Written straight into Qt, whose storage is kept when it fits,
+  // instead of going through A.transpose()
+  if(Qt.getNumRows() != n || Qt.getNumColumns() != m)
+    Qt = DenseMatrix<T>(n, m);
+  for(uint32_t i = 0; i < m; i++)
+  {
+    if(A.type() == DENSE)
+    {
+      const T * a = A[i].data();
+      for(uint32_t j = 0; j < n; j++)
+        Qt[j].data()[i] = a[j];
+    }
+    else
+      for(uint32_t j = 0; j < n; j++)
+        Qt[j].data()[i] = A(i, j);
+  }
+  orthogonalize(Qt, R);
+}
+
+template <typename T>
+void QRDecomp::multiplyRQ(const UpperTriMatrix<T>& R, const DenseMatrix<T>& Qt, DenseMatrix<T>& C) const
+{
+  uint32_t n = Qt.getNumRows();
+  if(C.getNumRows() != n || C.getNumColumns() != n)
+    C = DenseMatrix<T>(n, n);
 
-  Qt = DenseMatrix<T>(A.clone()->transpose());
-  X = DenseMatrix<T>(Qt.clone());
-  for (uint32_t i = 0; i < A.getNumColumns(); i++)
+  // (R Q)(i, j) = sum over p >= i of R(i, p) Qt(j, p): row i of R, which
+  // is stored from column i on, against row j of Qt
+  auto rows = [&](uint32_t first, uint32_t last)
   {
+    for(uint32_t i = first; i < last; i++)
+    {
+      const T * r = R[i].data();
+      T * c = C[i].data();
+      for(uint32_t j = 0; j < n; j++)
+      {
+        const T * q = Qt[j].data();
+        T sum = 0;
+        for(uint32_t p = i; p < n; p++)
+          sum += r[p - i] * q[p];
+        c[j] = sum;
+      }
+    }
+  };
+  if(static_cast<uint64_t>(n) * n * n < 2 * blas::PARALLEL_WORK)
+    rows(0, n);
+  else
+    ThreadPool::shared().parallelFor(0, n, blas::ROW_BLOCK, rows);
+}
+
+template <typename T>
+void QRDecomp::factorInPlace(DenseMatrix<T>& A, UpperTriMatrix<T>& R) const
+{
+  TraceSpan span("QRDecomp::factor");
+  if(A.getNumRows() != A.getNumColumns())
+    throw domain_error("Matrix must be square: QRDecomp::factorInPlace.");
+
+  for(uint32_t i = 0; i < A.getNumRows(); i++)
+    for(uint32_t j = i + 1; j < A.getNumColumns(); j++)
+      swap(A[i].data()[j], A[j].data()[i]);
+  orthogonalize(A, R);
+}
+
+template <typename T>
+void QRDecomp::orthogonalize(DenseMatrix<T>& Qt, UpperTriMatrix<T>& R) const
+{
+  uint32_t n = Qt.getNumRows();
+  T top, bottom;
+  // Original column of A for the row being worked on
+  MathVector<T> x;
+
+  if(R.getNumRows() != n)
+    R = UpperTriMatrix<T>(n);
+
+  for (uint32_t i = 0; i < n; i++)
+  {
+    TraceSpan column_span("QRDecomp::orthogonalizeColumn");
+    x = Qt[i];
+
     // Subtract projections
     for (int32_t j = i - 1; j >= 0; j--)
     {
-      temp = Qt[j];
-      top = X[i] * temp;
-      bottom = (temp * temp);
-      Qt[i] -= (top / bottom) * Qt[j];
+      const MathVector<T>& q = Qt[j];
+      top = x * q;
+      bottom = q * q;
+      axpy(-(top / bottom), q, Qt[i]);
     }
 
     // Make Q columns orthonormal
-    Qt[i] = (1.0 / Qt[i].magnitude()) * Qt[i];
+    scal(T(1) / Qt[i].magnitude(), Qt[i]);
+
+    // Column i of R is Qt * (column i of A)
+    for (uint32_t j = 0; j <= i; j++)
+      R(j, i, Qt[j] * x);
   }
+}
 
-  // Change values of passed in Q and R
-  Q = DenseMatrix<T>(Qt.transpose());
-  R = UpperTriMatrix<T>((Qt * A).clone());
+template <typename T, uint32_t M, uint32_t N>
+void QRDecomp::operator ()(const FixedMatrix<T, M, N>& A, FixedMatrix<T, M, N>& Q, FixedMatrix<T, N, N>& R) const
+{
+  Q = A;
+  R = FixedMatrix<T, N, N>();
+
+  unroll<0, N>([&](auto j)
+  {
+    constexpr uint32_t J = decltype(j)::value;
+
+    // Subtract projections onto the finished columns
+    unroll<0, J>([&](auto k)
+    {
+      T dot = 0;
+      unroll<0, M>([&](auto i) { dot += Q(i, k) * Q(i, J); });
+      R.at(k, J) = dot;
+      unroll<0, M>([&](auto i) { Q.at(i, J) -= dot * Q(i, k); });
+    });
+
+    // Make the column orthonormal
+    T norm = 0;
+    unroll<0, M>([&](auto i) { norm += Q(i, J) * Q(i, J); });
+    norm = sqrt(norm);
+    R.at(J, J) = norm;
+    unroll<0, M>([&](auto i) { Q.at(i, J) /= norm; });
+  });
 }
 
 #endif //QR_DECOMP_HPP
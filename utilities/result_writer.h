@@ -0,0 +1,158 @@
+//////////////////////////////////////////////////////////////////////
+/// @file result_writer.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the BufferedWriter
+///        class and the CSV, binary and VTK result writers
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class BufferedWriter
+/// @brief Output sink for large results. Text is formatted with
+///        to_chars into one large buffer that goes to the stream in a
+///        single write when full, so there is no per element stream
+///        formatting and no flush per row like operator << does.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn BufferedWriter(ostream& out, size_t capacity)
+/// @brief Constructor.
+/// @pre out stays open for the writer's lifetime.
+/// @post Up to capacity bytes are held before they reach out.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void number(T value)
+/// @brief Appends value as text.
+/// @pre T is an arithmetic type.
+/// @post With precision 0 (the default) floating point values are
+///       written in the shortest form that reads back exactly,
+///       otherwise with that many significant digits.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void raw(const void * data, size_t bytes)
+/// @brief Appends bytes unchanged, for binary output.
+/// @pre None.
+/// @post The bytes follow whatever was written before.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void flush()
+/// @brief Hands the buffer to the stream and flushes it.
+/// @pre None.
+/// @post Everything written so far has reached the stream. Also done
+///       by the destructor.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void write_csv(BufferedWriter& w, const MathVector<T>& x)
+/// @fn void write_csv(BufferedWriter& w, const BaseMatrix<T>& A)
+/// @brief One entry per line for vectors, one comma separated line per
+///        row for matrices.
+/// @pre None.
+/// @post The values are in w.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void write_binary(BufferedWriter& w, const MathVector<T>& x)
+/// @fn void write_binary(BufferedWriter& w, const BaseMatrix<T>& A)
+/// @brief Rows and columns as two uint32_t, then every entry as a T in
+///        row major order, all in host byte order. A vector is n x 1.
+/// @pre None.
+/// @post The values are in w.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void write_vtk(BufferedWriter& w, const MathVector<T>& x, int32_t n)
+/// @brief Legacy VTK structured points file of a Dirichlet solution on
+///        the interior points, numbered as DirichletSolver::pointIndex
+///        does, for ParaView or VisIt.
+/// @pre x has (n - 1)^2 entries.
+/// @post The file is in w.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void write_vtk<fnXL, fnXU, fnYL, fnYU>(BufferedWriter& w, const MathVector<T>& x, int32_t n)
+/// @brief Same, on the whole (n + 1) x (n + 1) grid with the boundary
+///        filled in from the functions DirichletSolver was given. The
+///        corners take the y boundary values.
+/// @pre x has (n - 1)^2 entries.
+/// @post The file is in w.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void set_diagnostics_enabled(bool on)
+/// @brief Switch for the diagnostic printing solvers do as they go,
+///        such as DirichletSolver::makeMatrix's right hand side dump and
+///        the QRDecomp eigenvalue iteration report.
+/// @pre None.
+/// @post Those prints only happen while on is true (the default).
+//////////////////////////////////////////////////////////////////////
+
+#ifndef RESULT_WRITER_H
+#define RESULT_WRITER_H
+
+#include <atomic>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "../interfaces/base_matrix.h"
+#include "math_vector.h"
+
+using namespace std;
+
+class BufferedWriter
+{
+private:
+  ostream& m_out;
+  vector<char> m_buffer;
+  size_t m_used;
+  int m_precision;
+
+  // Room for any one formatted number
+  static const size_t NUMBER_ROOM = 128;
+
+  void reserve(size_t bytes);
+
+public:
+  BufferedWriter(ostream& out, size_t capacity = 1 << 20);
+  ~BufferedWriter() { flush(); }
+
+  BufferedWriter(const BufferedWriter&) = delete;
+  BufferedWriter& operator =(const BufferedWriter&) = delete;
+
+  void setPrecision(int digits) { m_precision = digits; }
+
+  void put(char c);
+  void put(const char * text);
+  void put(const string& text);
+  template <typename T>
+  void number(T value);
+  void raw(const void * data, size_t bytes);
+  void flush();
+};
+
+void set_diagnostics_enabled(bool on);
+bool diagnostics_enabled();
+
+template <typename T>
+void write_csv(BufferedWriter& w, const MathVector<T>& x);
+
+template <typename T>
+void write_csv(BufferedWriter& w, const BaseMatrix<T>& A);
+
+template <typename T>
+void write_binary(BufferedWriter& w, const MathVector<T>& x);
+
+template <typename T>
+void write_binary(BufferedWriter& w, const BaseMatrix<T>& A);
+
+template <typename T>
+void write_vtk(BufferedWriter& w, const MathVector<T>& x, int32_t n);
+
+template <long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double), typename T>
+void write_vtk(BufferedWriter& w, const MathVector<T>& x, int32_t n);
+
+#include "result_writer.hpp"
+
+#endif //RESULT_WRITER_H
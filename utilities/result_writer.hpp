@@ -0,0 +1,216 @@
+//////////////////////////////////////////////////////////////////////
+/// @file result_writer.hpp
+/// @author Connor McBride
+/// @brief Contains the BufferedWriter and result writer implementation
+///        information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef RESULT_WRITER_HPP
+#define RESULT_WRITER_HPP
+
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+
+namespace output
+{
+  inline atomic<bool>& diagnosticsFlag()
+  {
+    static atomic<bool> flag(true);
+    return flag;
+  }
+}
+
+inline void set_diagnostics_enabled(bool on)
+{
+  output::diagnosticsFlag().store(on);
+}
+
+inline bool diagnostics_enabled()
+{
+  return output::diagnosticsFlag().load();
+}
+
+inline BufferedWriter::BufferedWriter(ostream& out, size_t capacity)
+  : m_out(out), m_buffer(max(capacity, 2 * NUMBER_ROOM)), m_used(0), m_precision(0)
+{
+}
+
+inline void BufferedWriter::reserve(size_t bytes)
+{
+  if(m_used + bytes > m_buffer.size())
+  {
+    m_out.write(m_buffer.data(), m_used);
+    m_used = 0;
+  }
+}
+
+inline void BufferedWriter::put(char c)
+{
+  reserve(1);
+  m_buffer[m_used++] = c;
+}
+
+inline void BufferedWriter::put(const char * text)
+{
+  raw(text, strlen(text));
+}
+
+inline void BufferedWriter::put(const string& text)
+{
+  raw(text.data(), text.size());
+}
+
+template <typename T>
+void BufferedWriter::number(T value)
+{
+  reserve(NUMBER_ROOM);
+  char * first = m_buffer.data() + m_used;
+  char * last = first + NUMBER_ROOM;
+  to_chars_result r;
+  if constexpr(is_floating_point<T>::value)
+    r = m_precision > 0 ? to_chars(first, last, value, chars_format::general, m_precision) : to_chars(first, last, value);
+  else
+    r = to_chars(first, last, value);
+  m_used = r.ptr - m_buffer.data();
+}
+
+inline void BufferedWriter::raw(const void * data, size_t bytes)
+{
+  const char * p = static_cast<const char *>(data);
+  if(bytes >= m_buffer.size())
+  {
+    reserve(m_buffer.size());
+    m_out.write(p, bytes);
+    return;
+  }
+  reserve(bytes);
+  memcpy(m_buffer.data() + m_used, p, bytes);
+  m_used += bytes;
+}
+
+inline void BufferedWriter::flush()
+{
+  m_out.write(m_buffer.data(), m_used);
+  m_used = 0;
+  m_out.flush();
+}
+
+template <typename T>
+void write_csv(BufferedWriter& w, const MathVector<T>& x)
+{
+  const T * xs = x.data();
+  for(uint32_t i = 0; i < x.size(); i++)
+  {
+    w.number(xs[i]);
+    w.put('\n');
+  }
+}
+
+template <typename T>
+void write_csv(BufferedWriter& w, const BaseMatrix<T>& A)
+{
+  bool dense = A.type() == DENSE;
+  for(uint32_t i = 0; i < A.getNumRows(); i++)
+  {
+    const T * row = dense ? A[i].data() : nullptr;
+    for(uint32_t j = 0; j < A.getNumColumns(); j++)
+    {
+      if(j > 0)
+        w.put(',');
+      w.number(dense ? row[j] : A(i, j));
+    }
+    w.put('\n');
+  }
+}
+
+template <typename T>
+void write_binary(BufferedWriter& w, const MathVector<T>& x)
+{
+  uint32_t shape[2] = {x.size(), 1};
+  w.raw(shape, sizeof(shape));
+  w.raw(x.data(), size_t(x.size()) * sizeof(T));
+}
+
+template <typename T>
+void write_binary(BufferedWriter& w, const BaseMatrix<T>& A)
+{
+  uint32_t shape[2] = {A.getNumRows(), A.getNumColumns()};
+  w.raw(shape, sizeof(shape));
+  for(uint32_t i = 0; i < A.getNumRows(); i++)
+  {
+    if(A.type() == DENSE)
+      w.raw(A[i].data(), size_t(A.getNumColumns()) * sizeof(T));
+    else
+      for(uint32_t j = 0; j < A.getNumColumns(); j++)
+      {
+        T value = A(i, j);
+        w.raw(&value, sizeof(T));
+      }
+  }
+}
+
+namespace output
+{
+  // Header and values of a side x side VTK grid, value(x, y) giving the
+  // point x across and y up; VTK wants x to vary fastest
+  template <class VALUE>
+  void vtkGrid(BufferedWriter& w, uint32_t side, double origin, double spacing, VALUE value)
+  {
+    w.put("# vtk DataFile Version 3.0\nDirichlet solution\nASCII\nDATASET STRUCTURED_POINTS\nDIMENSIONS ");
+    w.number(side);
+    w.put(' ');
+    w.number(side);
+    w.put(" 1\nORIGIN ");
+    w.number(origin);
+    w.put(' ');
+    w.number(origin);
+    w.put(" 0\nSPACING ");
+    w.number(spacing);
+    w.put(' ');
+    w.number(spacing);
+    w.put(" 1\nPOINT_DATA ");
+    w.number(side * side);
+    w.put("\nSCALARS u double 1\nLOOKUP_TABLE default\n");
+    for(uint32_t y = 0; y < side; y++)
+      for(uint32_t x = 0; x < side; x++)
+      {
+        w.number(static_cast<double>(value(x, y)));
+        w.put('\n');
+      }
+  }
+}
+
+template <typename T>
+void write_vtk(BufferedWriter& w, const MathVector<T>& x, int32_t n)
+{
+  uint32_t side = n - 1;
+  if(n < 2 || x.size() != side * side)
+    throw domain_error("Vector size not compatible: write_vtk.");
+  const T * xs = x.data();
+  output::vtkGrid(w, side, 1.0 / n, 1.0 / n, [&](uint32_t i, uint32_t j) { return xs[j * side + i]; });
+}
+
+template <long double fnXL (long double), long double fnXU (long double), long double fnYL (long double), long double fnYU (long double), typename T>
+void write_vtk(BufferedWriter& w, const MathVector<T>& x, int32_t n)
+{
+  uint32_t side = n - 1;
+  if(n < 2 || x.size() != side * side)
+    throw domain_error("Vector size not compatible: write_vtk.");
+  const T * xs = x.data();
+  long double diff = 1.0 / n;
+  output::vtkGrid(w, n + 1, 0.0, 1.0 / n, [&](uint32_t i, uint32_t j) -> long double
+  {
+    if(j == 0)
+      return fnYL(diff * i);
+    if(j == uint32_t(n))
+      return fnYU(diff * i);
+    if(i == 0)
+      return fnXL(diff * j);
+    if(i == uint32_t(n))
+      return fnXU(diff * j);
+    return xs[(j - 1) * side + (i - 1)];
+  });
+}
+
+#endif //RESULT_WRITER_HPP
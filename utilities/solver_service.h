@@ -0,0 +1,128 @@
+//////////////////////////////////////////////////////////////////////
+/// @file solver_service.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the SolverService class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class SolverService
+/// @brief Resident solve and eigenvalue service for driver --serve.
+///        Matrices loaded once stay factored in a keyed cache (least
+///        recently used goes first when full), request buffers keep
+///        their capacity and the shared ThreadPool stays up, so a
+///        warm SOLVE costs only the triangular solves.
+///
+///        Wire format, host byte order, all values double:
+///          request  Header, then the payload for op
+///            LOAD     n*n values, row major; cached under key
+///            SOLVE    n values; solved with the factors of key
+///            ONCE     n*n values then n; factored and solved, not kept
+///            EIGEN    none; k eigenvalues of key nearest target as
+///                     (real, imaginary) pairs
+///            RELEASE  none; drops key
+///            SHUTDOWN none; stops the service
+///          response Reply, then count values on OK or count bytes of
+///                   message on ERROR
+/// @pre SOLVER must provide Factors<T>, factor() and solve() like
+///      GaussianSolver does.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn SolverService(uint32_t cache_size)
+/// @brief Constructor.
+/// @pre None.
+/// @post At most cache_size (at least 1) matrices are kept factored.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn bool serve(int in, int out)
+/// @brief Answers requests read from in on out until end of input.
+///        Errors in a request are reported to the client and the
+///        service carries on; a malformed stream ends the session.
+/// @pre in and out are open file descriptors, e.g. 0 and 1.
+/// @post The cache keeps what the session loaded.
+/// @return Returns false once SHUTDOWN was received, true otherwise.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void listen(const string& path)
+/// @brief Serves one client connection at a time on a Unix domain
+///        socket at path until a client sends SHUTDOWN. Every
+///        connection sees the same warm cache.
+/// @pre path is not in use by a running service.
+/// @post The socket file is removed. Throws runtime_error if the
+///       socket cannot be set up.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SOLVER_SERVICE_H
+#define SOLVER_SERVICE_H
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../solvers/gaussian_solver.h"
+#include "krylov_eigen.h"
+#include "trace.h"
+
+using namespace std;
+
+template <class SOLVER = GaussianSolver>
+class SolverService
+{
+public:
+  enum Op : uint32_t { LOAD = 1, SOLVE = 2, ONCE = 3, EIGEN = 4, RELEASE = 5, SHUTDOWN = 6 };
+  enum Status : uint32_t { OK = 0, ERROR = 1 };
+
+  struct Header
+  {
+    uint32_t op;
+    uint32_t n;
+    // EIGEN only: how many eigenvalues and which EigenTarget
+    uint32_t k;
+    uint32_t target;
+    uint64_t key;
+  };
+
+  struct Reply
+  {
+    uint32_t status;
+    uint32_t count;
+  };
+
+private:
+  struct Entry
+  {
+    DenseMatrix<double> A;
+    typename SOLVER::template Factors<double> factors;
+    list<uint64_t>::iterator age;
+  };
+
+  uint32_t m_cache_size;
+  SOLVER m_solver;
+  map<uint64_t, Entry> m_cache;
+  // Keys from most to least recently used
+  list<uint64_t> m_ages;
+  // Reused between requests so a warm request does not allocate
+  vector<double> m_payload;
+  vector<double> m_reply;
+
+  Entry& lookup(uint64_t key);
+  void load(uint64_t key, uint32_t n);
+  void handle(const Header& h);
+
+  static bool readAll(int fd, void * data, size_t bytes);
+  static bool writeAll(int fd, const void * data, size_t bytes);
+
+public:
+  SolverService(uint32_t cache_size = 16) : m_cache_size(cache_size == 0 ? 1 : cache_size) {};
+
+  bool serve(int in, int out);
+  void listen(const string& path);
+};
+
+#include "solver_service.hpp"
+
+#endif //SOLVER_SERVICE_H
@@ -0,0 +1,256 @@
+//////////////////////////////////////////////////////////////////////
+/// @file solver_service.hpp
+/// @author Connor McBride
+/// @brief Contains the SolverService implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SOLVER_SERVICE_HPP
+#define SOLVER_SERVICE_HPP
+
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <stdexcept>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+template <class SOLVER>
+bool SolverService<SOLVER>::readAll(int fd, void * data, size_t bytes)
+{
+  char * p = static_cast<char *>(data);
+  while(bytes > 0)
+  {
+    ssize_t got = ::read(fd, p, bytes);
+    if(got < 0 && errno == EINTR)
+      continue;
+    if(got <= 0)
+      return false;
+    p += got;
+    bytes -= got;
+  }
+  return true;
+}
+
+template <class SOLVER>
+bool SolverService<SOLVER>::writeAll(int fd, const void * data, size_t bytes)
+{
+  const char * p = static_cast<const char *>(data);
+  while(bytes > 0)
+  {
+    ssize_t put = ::write(fd, p, bytes);
+    if(put < 0 && errno == EINTR)
+      continue;
+    if(put <= 0)
+      return false;
+    p += put;
+    bytes -= put;
+  }
+  return true;
+}
+
+template <class SOLVER>
+typename SolverService<SOLVER>::Entry& SolverService<SOLVER>::lookup(uint64_t key)
+{
+  typename map<uint64_t, Entry>::iterator it = m_cache.find(key);
+  if(it == m_cache.end())
+    throw out_of_range("No matrix loaded under key: SolverService.");
+  m_ages.splice(m_ages.begin(), m_ages, it->second.age);
+  return it->second;
+}
+
+template <class SOLVER>
+void SolverService<SOLVER>::load(uint64_t key, uint32_t n)
+{
+  TraceSpan span("SolverService::load");
+  // Factored aside first, so a matrix that fails to factor leaves the
+  // cache as it was
+  DenseMatrix<double> A(n);
+  for(uint32_t i = 0; i < n; i++)
+    copy(m_payload.data() + size_t(i) * n, m_payload.data() + size_t(i + 1) * n, A[i].data());
+  typename SOLVER::template Factors<double> factors;
+  m_solver.factor(A, factors);
+
+  typename map<uint64_t, Entry>::iterator it = m_cache.find(key);
+  if(it == m_cache.end())
+  {
+    if(m_cache.size() >= m_cache_size)
+    {
+      m_cache.erase(m_ages.back());
+      m_ages.pop_back();
+    }
+    m_ages.push_front(key);
+    it = m_cache.emplace(key, Entry()).first;
+    it->second.age = m_ages.begin();
+  }
+  else
+    m_ages.splice(m_ages.begin(), m_ages, it->second.age);
+
+  Entry& e = it->second;
+  swap(e.A, A);
+  swap(e.factors, factors);
+}
+
+template <class SOLVER>
+void SolverService<SOLVER>::handle(const Header& h)
+{
+  m_reply.clear();
+  switch(h.op)
+  {
+    case LOAD:
+      load(h.key, h.n);
+      break;
+    case SOLVE:
+    case ONCE:
+    {
+      TraceSpan span("SolverService::solve");
+      const double * b = m_payload.data();
+      MathVector<double> x(h.n);
+      if(h.op == ONCE)
+      {
+        DenseMatrix<double> A(h.n);
+        for(uint32_t i = 0; i < h.n; i++)
+          copy(b + size_t(i) * h.n, b + size_t(i + 1) * h.n, A[i].data());
+        b += size_t(h.n) * h.n;
+        for(uint32_t i = 0; i < h.n; i++)
+          x.push(b[i]);
+        typename SOLVER::template Factors<double> f;
+        m_solver.factor(A, f);
+        m_solver.solve(f, x);
+      }
+      else
+      {
+        Entry& e = lookup(h.key);
+        if(e.A.getNumRows() != h.n)
+          throw domain_error("Vector size not compatible: SolverService.");
+        for(uint32_t i = 0; i < h.n; i++)
+          x.push(b[i]);
+        m_solver.solve(e.factors, x);
+      }
+      m_reply.assign(x.data(), x.data() + h.n);
+      break;
+    }
+    case EIGEN:
+    {
+      TraceSpan span("SolverService::eigen");
+      if(h.target > SMALLEST_REAL)
+        throw domain_error("Unknown eigenvalue target: SolverService.");
+      Entry& e = lookup(h.key);
+      ArnoldiEigensolver arnoldi;
+      MathVector<complex<double>> values;
+      DenseMatrix<complex<double>> vectors;
+      arnoldi(e.A, h.k, static_cast<EigenTarget>(h.target), values, vectors);
+      for(uint32_t i = 0; i < values.size(); i++)
+      {
+        m_reply.push_back(values[i].real());
+        m_reply.push_back(values[i].imag());
+      }
+      break;
+    }
+    case RELEASE:
+    {
+      typename map<uint64_t, Entry>::iterator it = m_cache.find(h.key);
+      if(it != m_cache.end())
+      {
+        m_ages.erase(it->second.age);
+        m_cache.erase(it);
+      }
+      break;
+    }
+    case SHUTDOWN:
+      break;
+    default:
+      throw domain_error("Unknown request: SolverService.");
+  }
+}
+
+template <class SOLVER>
+bool SolverService<SOLVER>::serve(int in, int out)
+{
+  // Largest payload accepted; anything bigger is taken as a broken stream
+  const size_t MAX_VALUES = size_t(1) << 28;
+  Header h;
+
+  while(readAll(in, &h, sizeof(h)))
+  {
+    size_t values = 0;
+    if(h.op == LOAD)
+      values = size_t(h.n) * h.n;
+    else if(h.op == SOLVE)
+      values = h.n;
+    else if(h.op == ONCE)
+      values = size_t(h.n) * h.n + h.n;
+    if(values > MAX_VALUES)
+      return true;
+    m_payload.resize(values);
+    if(!readAll(in, m_payload.data(), values * sizeof(double)))
+      return true;
+
+    Reply r = {OK, 0};
+    string message;
+    try
+    {
+      handle(h);
+      r.count = m_reply.size();
+    }
+    catch(const exception& e)
+    {
+      message = e.what();
+      r.status = ERROR;
+      r.count = message.size();
+    }
+
+    bool sent = writeAll(out, &r, sizeof(r));
+    if(r.status == OK)
+      sent = sent && writeAll(out, m_reply.data(), m_reply.size() * sizeof(double));
+    else
+      sent = sent && writeAll(out, message.data(), message.size());
+    if(h.op == SHUTDOWN)
+      return false;
+    if(!sent)
+      return true;
+  }
+  return true;
+}
+
+template <class SOLVER>
+void SolverService<SOLVER>::listen(const string& path)
+{
+  sockaddr_un address;
+  memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if(path.size() >= sizeof(address.sun_path))
+    throw runtime_error("Socket path too long: SolverService.");
+  strcpy(address.sun_path, path.c_str());
+
+  // A client hanging up mid reply must not take the service down
+  signal(SIGPIPE, SIG_IGN);
+  int server = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if(server < 0)
+    throw runtime_error("Could not create socket: SolverService.");
+  ::unlink(path.c_str());
+  if(::bind(server, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0 || ::listen(server, 8) < 0)
+  {
+    ::close(server);
+    throw runtime_error("Could not listen on socket: SolverService.");
+  }
+
+  bool running = true;
+  while(running)
+  {
+    int client = ::accept(server, nullptr, nullptr);
+    if(client < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      break;
+    }
+    running = serve(client, client);
+    ::close(client);
+  }
+
+  ::close(server);
+  ::unlink(path.c_str());
+}
+
+#endif //SOLVER_SERVICE_HPP
@@ -0,0 +1,37 @@
+//////////////////////////////////////////////////////////////////////
+/// @file sparse_ordering.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the bandwidth
+///        reducing orderings of general sparse matrices
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn vector<uint32_t> reverse_cuthill_mckee(const SparseMatrix<T>& A)
+/// @brief Reverse Cuthill-McKee on the pattern of A + A^T. Each
+///        connected piece is numbered breadth first from a pseudo
+///        peripheral start (George and Liu's search), neighbours in order
+///        of increasing degree, and the whole order is then reversed.
+///        The result keeps the nonzeros near the diagonal, so the
+///        envelope a SkylineMatrix stores, and the fill of a factor
+///        inside it, stays small.
+/// @pre A is square. Its values are not looked at.
+/// @post None.
+/// @return Returns order, where order[k] is the row of A that becomes
+///         row k.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SPARSE_ORDERING_H
+#define SPARSE_ORDERING_H
+
+#include <algorithm>
+#include <vector>
+#include "../matrices/sparse_matrix.h"
+
+using namespace std;
+
+template <typename T>
+vector<uint32_t> reverse_cuthill_mckee(const SparseMatrix<T>& A);
+
+#include "sparse_ordering.hpp"
+
+#endif //SPARSE_ORDERING_H
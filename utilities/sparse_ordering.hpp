@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////
+/// @file sparse_ordering.hpp
+/// @author Connor McBride
+/// @brief Contains the sparse ordering implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef SPARSE_ORDERING_HPP
+#define SPARSE_ORDERING_HPP
+
+namespace sparse_ordering
+{
+  // Adjacency lists of an undirected graph in compressed form
+  struct Graph
+  {
+    vector<uint32_t> start;
+    vector<uint32_t> adjacent;
+
+    uint32_t degree(uint32_t v) const { return start[v + 1] - start[v]; }
+  };
+
+  // Breadth first levels from root. Leaves the visited nodes in reached,
+  // their distance from root in level, and returns the deepest level
+  inline uint32_t levels(const Graph& g, uint32_t root, vector<uint32_t>& level, vector<uint32_t>& reached)
+  {
+    for(uint32_t v : reached)
+      level[v] = UINT32_MAX;
+    reached.assign(1, root);
+    level[root] = 0;
+    for(size_t head = 0; head < reached.size(); head++)
+    {
+      uint32_t v = reached[head];
+      for(uint32_t e = g.start[v]; e < g.start[v + 1]; e++)
+        if(level[g.adjacent[e]] == UINT32_MAX)
+        {
+          level[g.adjacent[e]] = level[v] + 1;
+          reached.push_back(g.adjacent[e]);
+        }
+    }
+    return level[reached.back()];
+  }
+
+  // Moves root to the lowest degree node of the deepest level for as long
+  // as that makes the level structure deeper
+  inline uint32_t peripheral(const Graph& g, uint32_t root, vector<uint32_t>& level, vector<uint32_t>& reached)
+  {
+    uint32_t depth = levels(g, root, level, reached);
+    while(true)
+    {
+      uint32_t candidate = reached.back();
+      for(size_t k = reached.size(); k-- > 0 && level[reached[k]] == depth;)
+        if(g.degree(reached[k]) < g.degree(candidate))
+          candidate = reached[k];
+      uint32_t candidate_depth = levels(g, candidate, level, reached);
+      if(candidate_depth <= depth)
+        return root;
+      root = candidate;
+      depth = candidate_depth;
+    }
+  }
+}
+
+template <typename T>
+vector<uint32_t> reverse_cuthill_mckee(const SparseMatrix<T>& A)
+{
+  uint32_t n = A.getNumRows();
+  if(A.getNumColumns() != n)
+    throw domain_error("Matrix is not square: reverse_cuthill_mckee.");
+  const uint32_t * row_start = A.rowStart();
+  const uint32_t * columns = A.columns();
+
+  // Pattern of A + A^T without the diagonal, duplicates dropped
+  sparse_ordering::Graph g;
+  vector<uint32_t> count(n + 1, 0);
+  for(uint32_t r = 0; r < n; r++)
+    for(uint32_t e = row_start[r]; e < row_start[r + 1]; e++)
+      if(columns[e] != r)
+      {
+        count[r + 1]++;
+        count[columns[e] + 1]++;
+      }
+  for(uint32_t v = 0; v < n; v++)
+    count[v + 1] += count[v];
+  vector<uint32_t> both(count[n]);
+  vector<uint32_t> fill_at(count.begin(), count.end() - 1);
+  for(uint32_t r = 0; r < n; r++)
+    for(uint32_t e = row_start[r]; e < row_start[r + 1]; e++)
+      if(columns[e] != r)
+      {
+        both[fill_at[r]++] = columns[e];
+        both[fill_at[columns[e]]++] = r;
+      }
+  g.start.assign(1, 0);
+  g.adjacent.reserve(both.size());
+  for(uint32_t v = 0; v < n; v++)
+  {
+    auto first = both.begin() + count[v];
+    auto last = both.begin() + count[v + 1];
+    sort(first, last);
+    g.adjacent.insert(g.adjacent.end(), first, unique(first, last));
+    g.start.push_back(g.adjacent.size());
+  }
+
+  // Each piece starts from its lowest degree node, moved to a pseudo
+  // peripheral one
+  vector<uint32_t> by_degree(n);
+  for(uint32_t v = 0; v < n; v++)
+    by_degree[v] = v;
+  stable_sort(by_degree.begin(), by_degree.end(), [&](uint32_t a, uint32_t b) { return g.degree(a) < g.degree(b); });
+
+  vector<uint32_t> order;
+  order.reserve(n);
+  vector<bool> placed(n, false);
+  vector<uint32_t> level(n, UINT32_MAX);
+  vector<uint32_t> reached;
+  for(uint32_t seed : by_degree)
+  {
+    if(placed[seed])
+      continue;
+    uint32_t root = sparse_ordering::peripheral(g, seed, level, reached);
+    placed[root] = true;
+    order.push_back(root);
+    for(size_t head = order.size() - 1; head < order.size(); head++)
+    {
+      uint32_t v = order[head];
+      size_t added = order.size();
+      for(uint32_t e = g.start[v]; e < g.start[v + 1]; e++)
+        if(!placed[g.adjacent[e]])
+        {
+          placed[g.adjacent[e]] = true;
+          order.push_back(g.adjacent[e]);
+        }
+      stable_sort(order.begin() + added, order.end(), [&](uint32_t a, uint32_t b) { return g.degree(a) < g.degree(b); });
+    }
+  }
+
+  reverse(order.begin(), order.end());
+  return order;
+}
+
+#endif //SPARSE_ORDERING_HPP
@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////
+/// @file strassen.hpp
+/// @author Connor McBride
+/// @brief Contains the Strassen-Winograd implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef STRASSEN_HPP
+#define STRASSEN_HPP
+
+#include <algorithm>
+
+namespace strassen
+{
+  // Z = X + Y and Z = X - Y on r x c blocks with their own row strides
+  template <typename T>
+  void add(uint32_t r, uint32_t c, const T * X, size_t ldx, const T * Y, size_t ldy, T * Z, size_t ldz)
+  {
+    for(uint32_t i = 0; i < r; i++)
+      for(uint32_t j = 0; j < c; j++)
+        Z[i * ldz + j] = X[i * ldx + j] + Y[i * ldy + j];
+  }
+
+  template <typename T>
+  void sub(uint32_t r, uint32_t c, const T * X, size_t ldx, const T * Y, size_t ldy, T * Z, size_t ldz)
+  {
+    for(uint32_t i = 0; i < r; i++)
+      for(uint32_t j = 0; j < c; j++)
+        Z[i * ldz + j] = X[i * ldx + j] - Y[i * ldy + j];
+  }
+
+  // Classical C = A * B for the leaves, i-k-j with rows spread over the pool
+  template <typename T>
+  void classical(uint32_t m, uint32_t k, uint32_t n, const T * A, size_t lda, const T * B, size_t ldb, T * C, size_t ldc)
+  {
+    auto rows = [=](uint32_t first, uint32_t last)
+    {
+      for(uint32_t i = first; i < last; i++)
+      {
+        T * c = C + i * ldc;
+        fill(c, c + n, T(0));
+        for(uint32_t p = 0; p < k; p++)
+        {
+          T a = A[i * lda + p];
+          const T * b = B + p * ldb;
+          for(uint32_t j = 0; j < n; j++)
+            c[j] += a * b[j];
+        }
+      }
+    };
+    if(static_cast<uint64_t>(m) * n * k < blas::PARALLEL_WORK)
+      rows(0, m);
+    else
+      ThreadPool::shared().parallelFor(0, m, blas::ROW_BLOCK, rows);
+  }
+
+  // Doubles for one level's temporaries: X holds an A or C quadrant, Y a B quadrant
+  inline size_t levelWork(uint32_t m, uint32_t k, uint32_t n)
+  {
+    return static_cast<size_t>(m / 2) * max(k / 2, n / 2) + static_cast<size_t>(k / 2) * (n / 2);
+  }
+
+  // C = A * B. Sizes are even at every level above the leaves. Uses the
+  // two temporary schedule of Boyer, Dumas, Pernet and Zhou, with C's
+  // quadrants holding the other intermediate products.
+  template <typename T>
+  void winograd(uint32_t m, uint32_t k, uint32_t n, const T * A, size_t lda, const T * B, size_t ldb,
+                T * C, size_t ldc, uint32_t levels, T * work)
+  {
+    if(levels == 0)
+    {
+      classical(m, k, n, A, lda, B, ldb, C, ldc);
+      return;
+    }
+
+    uint32_t mh = m / 2, kh = k / 2, nh = n / 2;
+    const T * A11 = A;
+    const T * A12 = A + kh;
+    const T * A21 = A + mh * lda;
+    const T * A22 = A21 + kh;
+    const T * B11 = B;
+    const T * B12 = B + nh;
+    const T * B21 = B + kh * ldb;
+    const T * B22 = B21 + nh;
+    T * C11 = C;
+    T * C12 = C + nh;
+    T * C21 = C + mh * ldc;
+    T * C22 = C21 + nh;
+
+    // Temporaries for this level, the rest of work is for the levels below
+    T * X = work;
+    T * Y = X + static_cast<size_t>(mh) * max(kh, nh);
+    T * next = Y + static_cast<size_t>(kh) * nh;
+    size_t ldx = max(kh, nh);
+    size_t ldy = nh;
+
+    sub(mh, kh, A11, lda, A21, lda, X, ldx);                    // S3
+    sub(kh, nh, B22, ldb, B12, ldb, Y, ldy);                    // T3
+    winograd(mh, kh, nh, X, ldx, Y, ldy, C21, ldc, levels - 1, next);   // M7
+    add(mh, kh, A21, lda, A22, lda, X, ldx);                    // S1
+    sub(kh, nh, B12, ldb, B11, ldb, Y, ldy);                    // T1
+    winograd(mh, kh, nh, X, ldx, Y, ldy, C22, ldc, levels - 1, next);   // M5
+    sub(mh, kh, X, ldx, A11, lda, X, ldx);                      // S2
+    sub(kh, nh, B22, ldb, Y, ldy, Y, ldy);                      // T2
+    winograd(mh, kh, nh, X, ldx, Y, ldy, C12, ldc, levels - 1, next);   // M6
+    sub(mh, kh, A12, lda, X, ldx, X, ldx);                      // S4
+    winograd(mh, kh, nh, X, ldx, B22, ldb, C11, ldc, levels - 1, next); // M3
+    winograd(mh, kh, nh, A11, lda, B11, ldb, X, ldx, levels - 1, next); // M1
+    add(mh, nh, X, ldx, C12, ldc, C12, ldc);                    // U2 = M1 + M6
+    add(mh, nh, C12, ldc, C21, ldc, C21, ldc);                  // U3 = U2 + M7
+    add(mh, nh, C12, ldc, C22, ldc, C12, ldc);                  // U4 = U2 + M5
+    add(mh, nh, C21, ldc, C22, ldc, C22, ldc);                  // C22 = U3 + M5
+    add(mh, nh, C12, ldc, C11, ldc, C12, ldc);                  // C12 = U4 + M3
+    sub(kh, nh, Y, ldy, B21, ldb, Y, ldy);                      // T4
+    winograd(mh, kh, nh, A22, lda, Y, ldy, C11, ldc, levels - 1, next); // M4
+    sub(mh, nh, C21, ldc, C11, ldc, C21, ldc);                  // C21 = U3 - M4
+    winograd(mh, kh, nh, A12, lda, B21, ldb, C11, ldc, levels - 1, next); // M2
+    add(mh, nh, X, ldx, C11, ldc, C11, ldc);                    // C11 = M1 + M2
+  }
+}
+
+template <typename T>
+void strassen_multiply(const DenseMatrix<T>& A, const DenseMatrix<T>& B, DenseMatrix<T>& C, bool trans_a, bool trans_b)
+{
+  TraceSpan span("strassen_multiply");
+  uint32_t m = trans_a ? A.getNumColumns() : A.getNumRows();
+  uint32_t k = trans_a ? A.getNumRows() : A.getNumColumns();
+  uint32_t n = trans_b ? B.getNumRows() : B.getNumColumns();
+  if((trans_b ? B.getNumColumns() : B.getNumRows()) != k || C.getNumRows() != m || C.getNumColumns() != n)
+    throw domain_error("Matrix sizes not compatible: strassen_multiply.");
+
+  // Recurse until the smallest side reaches the cutoff, padding each side
+  // up to a multiple of 2^levels so every split is even
+  uint32_t levels = 0;
+  while((min(m, min(k, n)) >> levels) > strassen::CUTOFF)
+    levels++;
+  uint32_t unit = 1u << levels;
+  uint32_t pm = (m + unit - 1) / unit * unit;
+  uint32_t pk = (k + unit - 1) / unit * unit;
+  uint32_t pn = (n + unit - 1) / unit * unit;
+
+  // A transposed operand is turned around while it is copied in
+  vector<T> a(static_cast<size_t>(pm) * pk, T(0));
+  vector<T> b(static_cast<size_t>(pk) * pn, T(0));
+  vector<T> c(static_cast<size_t>(pm) * pn);
+  if(trans_a)
+    for(uint32_t p = 0; p < k; p++)
+    {
+      const T * row = A[p].data();
+      for(uint32_t i = 0; i < m; i++)
+        a[static_cast<size_t>(i) * pk + p] = row[i];
+    }
+  else
+    for(uint32_t i = 0; i < m; i++)
+      copy(A[i].data(), A[i].data() + k, a.begin() + static_cast<size_t>(i) * pk);
+  if(trans_b)
+    for(uint32_t j = 0; j < n; j++)
+    {
+      const T * row = B[j].data();
+      for(uint32_t p = 0; p < k; p++)
+        b[static_cast<size_t>(p) * pn + j] = row[p];
+    }
+  else
+    for(uint32_t i = 0; i < k; i++)
+      copy(B[i].data(), B[i].data() + n, b.begin() + static_cast<size_t>(i) * pn);
+
+  // One workspace for every level's temporaries
+  size_t work_size = 0;
+  for(uint32_t l = 0; l < levels; l++)
+    work_size += strassen::levelWork(pm >> l, pk >> l, pn >> l);
+  vector<T> work(work_size);
+
+  strassen::winograd(pm, pk, pn, a.data(), pk, b.data(), pn, c.data(), pn, levels, work.data());
+
+  for(uint32_t i = 0; i < m; i++)
+    copy(c.begin() + static_cast<size_t>(i) * pn, c.begin() + static_cast<size_t>(i) * pn + n, C[i].data());
+}
+
+#endif //STRASSEN_HPP
@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////
+/// @file thread_pool.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the ThreadPool class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class ThreadPool
+/// @brief Fixed set of worker threads fed from one task queue. Solvers
+///        share the pool returned by shared() instead of making threads.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn ThreadPool(uint32_t num_threads)
+/// @brief Overload of constructor which starts num_threads workers.
+/// @pre None.
+/// @post num_threads workers (at least 1) are waiting for tasks.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn ~ThreadPool()
+/// @brief Overload of the destructor.
+/// @pre None.
+/// @post Queued tasks are finished and all workers are joined.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn static ThreadPool& shared()
+/// @brief Returns the process wide pool, sized to the hardware.
+/// @pre None.
+/// @post The pool is started on first use.
+/// @return Returns the shared pool.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn future<R> submit(F f)
+/// @brief Queues f to run on a worker.
+/// @pre f is callable with no arguments.
+/// @post f runs on some worker at some later point.
+/// @param1 Callable to run.
+/// @return Returns a future holding the result or exception of f.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void parallelFor(uint32_t begin, uint32_t end, uint32_t grain, F f)
+/// @brief Splits [begin, end) into chunks of grain and calls f(first, last)
+///        for each chunk across the workers and the calling thread.
+/// @pre f is callable as f(uint32_t, uint32_t) and safe to run concurrently.
+/// @post Every chunk has finished. The first exception thrown by f, if
+///       any, is rethrown. The calling thread takes chunks itself, so
+///       calling this from inside a pool task cannot deadlock.
+/// @param1 First index.
+/// @param2 One past the last index.
+/// @param3 Largest number of indices handed out at once.
+/// @param4 Chunk body.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+class ThreadPool
+{
+private:
+  vector<thread> m_workers;
+  queue<function<void()>> m_tasks;
+  mutex m_mutex;
+  condition_variable m_ready;
+  bool m_stop;
+
+  void work();
+
+public:
+  ThreadPool(uint32_t num_threads);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator =(const ThreadPool&) = delete;
+
+  static ThreadPool& shared();
+  uint32_t size() const { return m_workers.size(); }
+
+  template <class F>
+  future<typename result_of<F()>::type> submit(F f);
+
+  template <class F>
+  void parallelFor(uint32_t begin, uint32_t end, uint32_t grain, F f);
+};
+
+#include "thread_pool.hpp"
+
+#endif //THREAD_POOL_H
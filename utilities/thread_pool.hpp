@@ -0,0 +1,132 @@
+//////////////////////////////////////////////////////////////////////
+/// @file thread_pool.hpp
+/// @author Connor McBride
+/// @brief Contains the ThreadPool class implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+inline ThreadPool::ThreadPool(uint32_t num_threads)
+{
+  m_stop = false;
+  if(num_threads == 0)
+    num_threads = 1;
+  for(uint32_t i = 0; i < num_threads; i++)
+    m_workers.emplace_back(&ThreadPool::work, this);
+}
+
+inline ThreadPool::~ThreadPool()
+{
+  {
+    lock_guard<mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_ready.notify_all();
+  for(uint32_t i = 0; i < m_workers.size(); i++)
+    m_workers[i].join();
+}
+
+inline ThreadPool& ThreadPool::shared()
+{
+  static ThreadPool pool(thread::hardware_concurrency());
+  return pool;
+}
+
+inline void ThreadPool::work()
+{
+  while(true)
+  {
+    function<void()> task;
+    {
+      unique_lock<mutex> lock(m_mutex);
+      m_ready.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+      if(m_tasks.empty())
+        return;
+      task = move(m_tasks.front());
+      m_tasks.pop();
+    }
+    task();
+  }
+}
+
+template <class F>
+future<typename result_of<F()>::type> ThreadPool::submit(F f)
+{
+  typedef typename result_of<F()>::type R;
+  shared_ptr<packaged_task<R()>> task = make_shared<packaged_task<R()>>(move(f));
+  future<R> ret = task->get_future();
+  {
+    lock_guard<mutex> lock(m_mutex);
+    m_tasks.push([task] { (*task)(); });
+  }
+  m_ready.notify_one();
+  return ret;
+}
+
+template <class F>
+void ThreadPool::parallelFor(uint32_t begin, uint32_t end, uint32_t grain, F f)
+{
+  if(begin >= end)
+    return;
+  if(grain == 0)
+    grain = 1;
+  uint32_t chunks = (end - begin + grain - 1) / grain;
+  if(chunks == 1)
+  {
+    f(begin, end);
+    return;
+  }
+
+  // Shared with the helper tasks, which may only start after we return
+  struct State
+  {
+    F body;
+    atomic<uint32_t> next;
+    uint32_t done;
+    mutex lock;
+    condition_variable finished;
+    exception_ptr error;
+    State(F f) : body(move(f)), next(0), done(0) {}
+  };
+  shared_ptr<State> state = make_shared<State>(move(f));
+
+  function<void()> run = [state, begin, end, grain, chunks]
+  {
+    uint32_t chunk;
+    while((chunk = state->next.fetch_add(1)) < chunks)
+    {
+      uint32_t first = begin + chunk * grain;
+      uint32_t last = (end - first > grain) ? first + grain : end;
+      try
+      {
+        state->body(first, last);
+      }
+      catch(...)
+      {
+        lock_guard<mutex> lock(state->lock);
+        if(!state->error)
+          state->error = current_exception();
+      }
+      lock_guard<mutex> lock(state->lock);
+      if(++state->done == chunks)
+        state->finished.notify_all();
+    }
+  };
+
+  uint32_t helpers = min(size(), chunks - 1);
+  {
+    lock_guard<mutex> lock(m_mutex);
+    for(uint32_t i = 0; i < helpers; i++)
+      m_tasks.push(run);
+  }
+  m_ready.notify_all();
+
+  run();
+  unique_lock<mutex> lock(state->lock);
+  state->finished.wait(lock, [&state, chunks] { return state->done == chunks; });
+  if(state->error)
+    rethrow_exception(state->error);
+}
+
+#endif //THREAD_POOL_HPP
@@ -0,0 +1,118 @@
+//////////////////////////////////////////////////////////////////////
+/// @file trace.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the tracing classes
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class TraceBuffer
+/// @brief Fixed size ring buffer of completed spans owned by one thread.
+///        Only the owning thread writes to it, so recording needs no lock.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class Tracer
+/// @brief Static front end that hands out the per-thread buffers and
+///        exports everything recorded in the Chrome trace event format.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn static void enable(bool on)
+/// @brief Turns recording on or off for every thread.
+/// @pre None.
+/// @post Spans opened after the call are recorded only if on is true.
+/// @param1 Whether or not spans should be recorded.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn static void writeChromeTrace(ostream& out)
+/// @brief Writes every buffered span as a Chrome trace event JSON document.
+/// @pre Should be called while no spans are being recorded, otherwise
+///      events being overwritten at that moment may come out torn.
+/// @post out holds a document loadable by chrome://tracing or Perfetto.
+/// @param1 ostream the document is written to.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class TraceSpan
+/// @brief RAII span. Records the time between construction and
+///        destruction under name in the calling thread's buffer.
+/// @pre name must outlive the program's last call to writeChromeTrace
+///      (string literals are the intended use).
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void stop()
+/// @brief Ends the span before the object goes out of scope.
+/// @pre None.
+/// @post The span is recorded now and the destructor records nothing.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+
+using namespace std;
+
+struct TraceEvent
+{
+  const char * name;
+  uint64_t start_ns;
+  uint64_t duration_ns;
+};
+
+class TraceBuffer
+{
+public:
+  static const uint32_t CAPACITY = 1 << 14;
+
+  TraceBuffer(uint32_t thread_id) : m_head(0), m_thread_id(thread_id), m_next(nullptr) {}
+
+  void record(const char * name, uint64_t start_ns, uint64_t duration_ns);
+
+  TraceEvent m_events[CAPACITY];
+  atomic<uint64_t> m_head;
+  uint32_t m_thread_id;
+  TraceBuffer * m_next;
+};
+
+class Tracer
+{
+public:
+  static void enable(bool on) { enabledFlag().store(on, memory_order_relaxed); }
+  static bool enabled() { return enabledFlag().load(memory_order_relaxed); }
+  static uint64_t now();
+  static TraceBuffer& localBuffer();
+  static void writeChromeTrace(ostream& out);
+
+private:
+  static atomic<bool>& enabledFlag();
+  static atomic<TraceBuffer *>& bufferList();
+  static atomic<uint32_t>& threadCount();
+};
+
+class TraceSpan
+{
+private:
+  const char * m_name;
+  uint64_t m_start;
+  bool m_active;
+
+public:
+  TraceSpan(const char * name);
+  ~TraceSpan();
+
+  void stop();
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator =(const TraceSpan&) = delete;
+};
+
+#include "trace.hpp"
+
+#endif //TRACE_H
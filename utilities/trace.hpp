@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////
+/// @file trace.hpp
+/// @author Connor McBride
+/// @brief Contains the tracing implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+inline void TraceBuffer::record(const char * name, uint64_t start_ns, uint64_t duration_ns)
+{
+  // Single writer, so a relaxed read of our own head is enough. Publishing the
+  // new head with release lets the exporter see the completed slot.
+  uint64_t head = m_head.load(memory_order_relaxed);
+  TraceEvent& event = m_events[head % CAPACITY];
+  event.name = name;
+  event.start_ns = start_ns;
+  event.duration_ns = duration_ns;
+  m_head.store(head + 1, memory_order_release);
+}
+
+inline atomic<bool>& Tracer::enabledFlag()
+{
+  static atomic<bool> flag(false);
+  return flag;
+}
+
+inline atomic<TraceBuffer *>& Tracer::bufferList()
+{
+  static atomic<TraceBuffer *> head(nullptr);
+  return head;
+}
+
+inline atomic<uint32_t>& Tracer::threadCount()
+{
+  static atomic<uint32_t> count(0);
+  return count;
+}
+
+inline uint64_t Tracer::now()
+{
+  return chrono::duration_cast<chrono::nanoseconds>(
+      chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline TraceBuffer& Tracer::localBuffer()
+{
+  // Buffers are never freed so spans from finished threads can still be exported.
+  static thread_local TraceBuffer * buffer = nullptr;
+  if(buffer == nullptr)
+  {
+    buffer = new TraceBuffer(threadCount().fetch_add(1) + 1);
+    buffer->m_next = bufferList().load(memory_order_relaxed);
+    while(!bufferList().compare_exchange_weak(buffer->m_next, buffer,
+                                              memory_order_release, memory_order_relaxed))
+      ;
+  }
+  return *buffer;
+}
+
+inline void Tracer::writeChromeTrace(ostream& out)
+{
+  bool first = true;
+  out << "{\"traceEvents\":[";
+  for(TraceBuffer * buffer = bufferList().load(memory_order_acquire); buffer != nullptr; buffer = buffer->m_next)
+  {
+    uint64_t head = buffer->m_head.load(memory_order_acquire);
+    uint64_t begin = head > TraceBuffer::CAPACITY ? head - TraceBuffer::CAPACITY : 0;
+
+    // Name the thread so the viewer labels its track
+    out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+        << buffer->m_thread_id << ",\"args\":{\"name\":\"thread " << buffer->m_thread_id << "\"}}";
+    first = false;
+
+    for(uint64_t i = begin; i < head; i++)
+    {
+      const TraceEvent& event = buffer->m_events[i % TraceBuffer::CAPACITY];
+      // Chrome expects microseconds; keep the nanosecond part as decimals
+      out << ",\n{\"name\":\"" << event.name << "\",\"cat\":\"solver\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+          << buffer->m_thread_id
+          << ",\"ts\":" << event.start_ns / 1000 << "." << setw(3) << setfill('0') << event.start_ns % 1000
+          << ",\"dur\":" << event.duration_ns / 1000 << "." << setw(3) << event.duration_ns % 1000
+          << setfill(' ') << "}";
+    }
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+inline TraceSpan::TraceSpan(const char * name)
+{
+  m_name = name;
+  m_active = Tracer::enabled();
+  m_start = m_active ? Tracer::now() : 0;
+}
+
+inline TraceSpan::~TraceSpan()
+{
+  stop();
+}
+
+inline void TraceSpan::stop()
+{
+  if(m_active)
+    Tracer::localBuffer().record(m_name, m_start, Tracer::now() - m_start);
+  m_active = false;
+}
+
+#endif //TRACE_HPP
@@ -0,0 +1,49 @@
+//////////////////////////////////////////////////////////////////////
+/// @file trsm.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the blocked triangular
+///        solves shared by the factorization based solvers
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void trsm_lower_unit(const LOWER& L, DenseMatrix<T>& B)
+/// @brief Solves LX = B in place for a unit lower triangular L.
+/// @pre L(i, j) returns the (i, j) entry of L for j < i. B has as many
+///      rows as L.
+/// @post B holds X.
+/// @param1 Entry accessor for L.
+/// @param2 Right hand sides, one per column.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void trsm_upper(const UPPER& U, DenseMatrix<T>& B)
+/// @brief Solves UX = B in place for an upper triangular U.
+/// @pre U(i, j) returns the (i, j) entry of U for j >= i. B has as many
+///      rows as U.
+/// @post B holds X.
+/// @param1 Entry accessor for U.
+/// @param2 Right hand sides, one per column.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TRSM_H
+#define TRSM_H
+
+#include "../matrices/dense_matrix.h"
+
+namespace trsm
+{
+  // Rows of the triangle and columns of B worked on at a time, sized so a
+  // block of B stays in cache while it is reused
+  const uint32_t ROW_BLOCK = 64;
+  const uint32_t COLUMN_BLOCK = 256;
+}
+
+template <typename T, class LOWER>
+void trsm_lower_unit(const LOWER& L, DenseMatrix<T>& B);
+
+template <typename T, class UPPER>
+void trsm_upper(const UPPER& U, DenseMatrix<T>& B);
+
+#include "trsm.hpp"
+
+#endif //TRSM_H
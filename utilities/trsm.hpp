@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////
+/// @file trsm.hpp
+/// @author Connor McBride
+/// @brief Contains the blocked triangular solve implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TRSM_HPP
+#define TRSM_HPP
+
+#include <algorithm>
+
+template <typename T, class LOWER>
+void trsm_lower_unit(const LOWER& L, DenseMatrix<T>& B)
+{
+  uint32_t n = B.getNumRows();
+  uint32_t k = B.getNumColumns();
+
+  for(uint32_t c0 = 0; c0 < k; c0 += trsm::COLUMN_BLOCK)
+  {
+    uint32_t c1 = min(k, c0 + trsm::COLUMN_BLOCK);
+    for(uint32_t i0 = 0; i0 < n; i0 += trsm::ROW_BLOCK)
+    {
+      uint32_t i1 = min(n, i0 + trsm::ROW_BLOCK);
+
+      // Update this block of rows with every solved block above it, then
+      // finish the small triangle on the diagonal
+      for(uint32_t j0 = 0; j0 <= i0; j0 += trsm::ROW_BLOCK)
+      {
+        for(uint32_t i = i0; i < i1; i++)
+        {
+          T * b_i = B[i].data();
+          uint32_t j1 = min(i, j0 + trsm::ROW_BLOCK);
+          for(uint32_t j = j0; j < j1; j++)
+          {
+            T l = L(i, j);
+            const T * b_j = B[j].data();
+            for(uint32_t c = c0; c < c1; c++)
+              b_i[c] -= l * b_j[c];
+          }
+        }
+      }
+    }
+  }
+}
+
+template <typename T, class UPPER>
+void trsm_upper(const UPPER& U, DenseMatrix<T>& B)
+{
+  uint32_t n = B.getNumRows();
+  uint32_t k = B.getNumColumns();
+  uint32_t blocks = (n + trsm::ROW_BLOCK - 1) / trsm::ROW_BLOCK;
+
+  for(uint32_t c0 = 0; c0 < k; c0 += trsm::COLUMN_BLOCK)
+  {
+    uint32_t c1 = min(k, c0 + trsm::COLUMN_BLOCK);
+    for(uint32_t ib = blocks; ib-- > 0; )
+    {
+      uint32_t i0 = ib * trsm::ROW_BLOCK;
+      uint32_t i1 = min(n, i0 + trsm::ROW_BLOCK);
+
+      // Update this block of rows with every solved block below it
+      for(uint32_t j0 = i1; j0 < n; j0 += trsm::ROW_BLOCK)
+      {
+        uint32_t j1 = min(n, j0 + trsm::ROW_BLOCK);
+        for(uint32_t i = i0; i < i1; i++)
+        {
+          T * b_i = B[i].data();
+          for(uint32_t j = j0; j < j1; j++)
+          {
+            T u = U(i, j);
+            const T * b_j = B[j].data();
+            for(uint32_t c = c0; c < c1; c++)
+              b_i[c] -= u * b_j[c];
+          }
+        }
+      }
+
+      // Then finish the triangle on the diagonal from the bottom up
+      for(uint32_t i = i1; i-- > i0; )
+      {
+        T * b_i = B[i].data();
+        for(uint32_t j = i + 1; j < i1; j++)
+        {
+          T u = U(i, j);
+          const T * b_j = B[j].data();
+          for(uint32_t c = c0; c < c1; c++)
+            b_i[c] -= u * b_j[c];
+        }
+        T u_ii = U(i, i);
+        for(uint32_t c = c0; c < c1; c++)
+          b_i[c] /= u_ii;
+      }
+    }
+  }
+}
+
+#endif //TRSM_HPP
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////
+/// @file tsqr.h
+/// @author Connor McBride
+/// @brief Contains the declaration information for the TSQR class
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @class TSQR
+/// @brief Tall-skinny QR. The rows of A are split into one block per
+///        thread, each block is factored on its own with Householder
+///        reflections and the small R factors are merged pairwise in a
+///        reduction tree. Only R is formed; Q is never stored.
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn void operator ()(const DenseMatrix<T>& A, UpperTriMatrix<T>& R) const
+/// @brief Computes the R factor of A.
+/// @pre A has at least as many rows as columns.
+/// @post R is the n x n R factor of A with a non-negative diagonal.
+/// @param A the m x n matrix to be decomposed
+/// @param R the R factor of A
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> solve(const DenseMatrix<T>& A, const MathVector<T>& b) const
+/// @brief Least squares solution of Ax = b. b rides along as an extra
+///        column of A, so Q^T b falls out of the same reduction and the
+///        last diagonal entry of R is the residual norm.
+/// @pre A has more rows than columns and full column rank, b has as
+///      many entries as A has rows.
+/// @post Returns the x minimizing |Ax - b|.
+/// @param A the m x n system
+/// @param b the m right hand side values
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn MathVector<T> solve(const DenseMatrix<T>& A, const MathVector<T>& b, T& residual) const
+/// @brief Same as above but also hands back |Ax - b|.
+/// @pre Same as above.
+/// @post Returns x and residual holds the norm of its residual.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TSQR_H
+#define TSQR_H
+
+#include <vector>
+#include "../matrices/dense_matrix.h"
+#include "../matrices/upper_tri_matrix.h"
+#include "thread_pool.h"
+#include "trace.h"
+
+class TSQR
+{
+public:
+  template <typename T>
+  void operator ()(const DenseMatrix<T>& A, UpperTriMatrix<T>& R) const;
+
+  template <typename T>
+  MathVector<T> solve(const DenseMatrix<T>& A, const MathVector<T>& b) const;
+  template <typename T>
+  MathVector<T> solve(const DenseMatrix<T>& A, const MathVector<T>& b, T& residual) const;
+
+private:
+  // w x w R factor of [A | b] (b is left out when it is null)
+  template <typename T>
+  DenseMatrix<T> reduce(const DenseMatrix<T>& A, const MathVector<T> * b) const;
+  // Householder QR of B in place, leaving R in its top rows
+  template <typename T>
+  void householder(DenseMatrix<T>& B) const;
+};
+
+#include "tsqr.hpp"
+
+#endif //TSQR_H
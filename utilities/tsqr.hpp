@@ -0,0 +1,187 @@
+//////////////////////////////////////////////////////////////////////
+/// @file tsqr.hpp
+/// @author Connor McBride
+/// @brief Contains the TSQR implementation information
+//////////////////////////////////////////////////////////////////////
+
+#ifndef TSQR_HPP
+#define TSQR_HPP
+
+#include <algorithm>
+#include <cmath>
+
+template <typename T>
+void TSQR::operator ()(const DenseMatrix<T>& A, UpperTriMatrix<T>& R) const
+{
+  DenseMatrix<T> top = reduce(A, static_cast<const MathVector<T> *>(nullptr));
+  uint32_t n = top.getNumRows();
+
+  if(R.getNumRows() != n)
+    R = UpperTriMatrix<T>(n);
+  for(uint32_t i = 0; i < n; i++)
+    for(uint32_t j = i; j < n; j++)
+      R(i, j, top[i].data()[j]);
+}
+
+template <typename T>
+MathVector<T> TSQR::solve(const DenseMatrix<T>& A, const MathVector<T>& b) const
+{
+  T residual;
+  return solve(A, b, residual);
+}
+
+template <typename T>
+MathVector<T> TSQR::solve(const DenseMatrix<T>& A, const MathVector<T>& b, T& residual) const
+{
+  if(b.size() != A.getNumRows())
+    throw domain_error("Vector size not compatible: TSQR.");
+
+  // R of [A | b] is [R  Q^T b; 0  |r|]
+  DenseMatrix<T> top = reduce(A, &b);
+  uint32_t n = A.getNumColumns();
+  MathVector<T> x(n);
+  T * y = x.data();
+
+  TraceSpan span("TSQR::backSubstitute");
+  for(int32_t i = n - 1; i >= 0; i--)
+  {
+    const T * row = top[i].data();
+    if(row[i] == T(0))
+      throw domain_error("Matrix is rank deficient: TSQR.");
+    T sum = row[n];
+    for(uint32_t j = i + 1; j < n; j++)
+      sum -= row[j] * y[j];
+    y[i] = sum / row[i];
+  }
+  residual = fabs(top[n].data()[n]);
+
+  // Fill in the size the way push would have
+  MathVector<T> result(n);
+  for(uint32_t i = 0; i < n; i++)
+    result.push(y[i]);
+  return result;
+}
+
+template <typename T>
+DenseMatrix<T> TSQR::reduce(const DenseMatrix<T>& A, const MathVector<T> * b) const
+{
+  uint32_t m = A.getNumRows();
+  uint32_t n = A.getNumColumns();
+  uint32_t w = n + (b != nullptr ? 1 : 0);
+  if(m < w)
+    throw domain_error("Matrix must have more rows than columns: TSQR.");
+
+  // One block per thread, each tall enough to be worth factoring alone
+  ThreadPool& pool = ThreadPool::shared();
+  uint32_t blocks = max(1u, min(pool.size(), m / (2 * w)));
+  vector<DenseMatrix<T>> R(blocks);
+
+  pool.parallelFor(0, blocks, 1, [&](uint32_t first, uint32_t last)
+  {
+    for(uint32_t p = first; p < last; p++)
+    {
+      TraceSpan span("TSQR::localFactor");
+      uint32_t row_begin = uint64_t(m) * p / blocks;
+      uint32_t row_end = uint64_t(m) * (p + 1) / blocks;
+      DenseMatrix<T> B(row_end - row_begin, w);
+
+      for(uint32_t i = row_begin; i < row_end; i++)
+      {
+        T * dst = B[i - row_begin].data();
+        copy(A[i].data(), A[i].data() + n, dst);
+        if(b != nullptr)
+          dst[n] = b->data()[i];
+      }
+      householder(B);
+
+      R[p] = DenseMatrix<T>(w, w);
+      for(uint32_t i = 0; i < w; i++)
+        copy(B[i].data() + i, B[i].data() + w, R[p][i].data() + i);
+    }
+  });
+
+  // Merge pairs of R factors until one is left
+  for(uint32_t stride = 1; stride < blocks; stride *= 2)
+  {
+    uint32_t pairs = (blocks + 2 * stride - 1) / (2 * stride);
+    pool.parallelFor(0, pairs, 1, [&](uint32_t first, uint32_t last)
+    {
+      for(uint32_t p = first; p < last; p++)
+      {
+        uint32_t lhs = 2 * stride * p;
+        uint32_t rhs = lhs + stride;
+        if(rhs >= blocks)
+          continue;
+
+        TraceSpan span("TSQR::combine");
+        DenseMatrix<T> S(2 * w, w);
+        for(uint32_t i = 0; i < w; i++)
+        {
+          copy(R[lhs][i].data() + i, R[lhs][i].data() + w, S[i].data() + i);
+          copy(R[rhs][i].data() + i, R[rhs][i].data() + w, S[w + i].data() + i);
+        }
+        householder(S);
+        for(uint32_t i = 0; i < w; i++)
+          copy(S[i].data() + i, S[i].data() + w, R[lhs][i].data() + i);
+      }
+    });
+  }
+
+  // Make the diagonal non-negative so R is unique
+  for(uint32_t i = 0; i < w; i++)
+  {
+    T * row = R[0][i].data();
+    if(row[i] < T(0))
+      for(uint32_t j = i; j < w; j++)
+        row[j] = -row[j];
+  }
+  return move(R[0]);
+}
+
+template <typename T>
+void TSQR::householder(DenseMatrix<T>& B) const
+{
+  uint32_t m = B.getNumRows();
+  uint32_t n = B.getNumColumns();
+  vector<T> v(m);
+  vector<T> s(n);
+
+  for(uint32_t j = 0; j < min(m, n); j++)
+  {
+    T norm = 0;
+    for(uint32_t i = j; i < m; i++)
+      norm += B[i].data()[j] * B[i].data()[j];
+    T head = B[j].data()[j];
+    if(norm == T(0))
+      continue;
+
+    // Reflect column j onto alpha * e_j, with alpha's sign chosen to
+    // avoid cancellation in v = x - alpha * e_j
+    T alpha = head > T(0) ? -sqrt(norm) : sqrt(norm);
+    for(uint32_t i = j; i < m; i++)
+      v[i] = B[i].data()[j];
+    v[j] = head - alpha;
+    T vtv = norm - head * head + v[j] * v[j];
+
+    // s = v^T B, then B -= (2 / v^T v) v s, both passes going along rows
+    fill(s.begin() + j + 1, s.end(), T(0));
+    for(uint32_t i = j; i < m; i++)
+    {
+      const T * row = B[i].data();
+      for(uint32_t k = j + 1; k < n; k++)
+        s[k] += v[i] * row[k];
+    }
+    T scale = T(2) / vtv;
+    for(uint32_t i = j; i < m; i++)
+    {
+      T * row = B[i].data();
+      T c = scale * v[i];
+      for(uint32_t k = j + 1; k < n; k++)
+        row[k] -= c * s[k];
+      row[j] = T(0);
+    }
+    B[j].data()[j] = alpha;
+  }
+}
+
+#endif //TSQR_HPP
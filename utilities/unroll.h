@@ -0,0 +1,40 @@
+//////////////////////////////////////////////////////////////////////
+/// @file unroll.h
+/// @author Connor McBride
+/// @brief Contains compile time loop unrolling used by the fixed size types
+//////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////
+/// @fn constexpr void unroll<BEGIN, END>(F&& f)
+/// @brief Calls f(integral_constant<uint32_t, i>()) for every i in
+///        [BEGIN, END), written out in full at compile time. Inside a
+///        generic lambda decltype(i)::value is a constant expression, so
+///        loops can be nested with bounds taken from the outer index.
+/// @pre f is callable with an integral_constant<uint32_t, i>.
+/// @post f has been called END - BEGIN times in increasing order of i.
+/// @param1 Loop body.
+//////////////////////////////////////////////////////////////////////
+
+#ifndef UNROLL_H
+#define UNROLL_H
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+
+template <uint32_t BEGIN, class F, uint32_t... I>
+constexpr void unroll_impl(F&& f, integer_sequence<uint32_t, I...>)
+{
+  (f(integral_constant<uint32_t, BEGIN + I>()), ...);
+}
+
+template <uint32_t BEGIN, uint32_t END, class F>
+constexpr void unroll(F&& f)
+{
+  if constexpr(END > BEGIN)
+    unroll_impl<BEGIN>(f, make_integer_sequence<uint32_t, END - BEGIN>());
+}
+
+#endif //UNROLL_H